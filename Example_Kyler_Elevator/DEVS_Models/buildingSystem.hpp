@@ -0,0 +1,73 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * A coupled DEVS model of a building with any number of floors and elevator cars,
+ * generalizing elevatorSystem (4 floors, one car) for simulation studies.
+ *
+ * Floor requests are read from floorRequestInput.txt ("time floor" on every line)
+ * and sent to the elevatorDispatcher, which assigns each one to an elevatorCar.
+ * Requests are queued by the cars whatever the state of their door, instead of
+ * being dropped while the door is closed as elevatorNum does.
+ *
+ * This model has no embedded IO: the MSP432 build keeps using elevatorSystem.
+ */
+
+#ifndef __BUILDING_SYSTEM_HPP__
+#define __BUILDING_SYSTEM_HPP__
+
+// This is a coupled model, meaning it has no internal computation, and is
+// used to connect atomic models.  So, it is necessary to include coupled.hpp
+#include <modeling/devs/coupled.hpp>
+#ifdef BINARY_INPUT
+    #include "../../Shared_Models/binaryInputStream.hpp"
+#else
+    #include <lib/iestream.hpp>
+#endif
+#include <string>
+
+// We include any models that are directly contained within this coupled model
+#include "elevatorCar.hpp"
+#include "elevatorDispatcher.hpp"
+#include "../../Simulation/transitionProfiler.hpp"
+
+namespace cadmium::elevatorSystem {
+    class buildingSystem : public Coupled {
+        public:
+        /**
+         * @param id ID of the system.
+         * @param floorCount number of floors, numbered from 1.
+         * @param carCount number of elevator cars.
+         * @param floorTravelTime time in seconds taken to move a car by one floor.
+         * @param doorOpenTime time in seconds the door of a car stays open at each stop.
+         * @param inputFolder folder holding floorRequestInput.txt.
+         */
+        buildingSystem(const std::string& id, int floorCount = 40, int carCount = 8, double floorTravelTime = 2.0,
+                       double doorOpenTime = 3.0, const std::string& inputFolder = "."): Coupled(id){
+
+            // Declare and initialize all controller models (non-input/output)
+            auto dispatcher = addComponent<Profiled<ElevatorDispatcher>>("dispatcher", floorCount, carCount, floorTravelTime, doorOpenTime);
+
+            for (int i = 0; i < carCount; i++) {
+                auto car = addComponent<Profiled<ElevatorCar>>("car" + std::to_string(i), i, floorCount, floorTravelTime, doorOpenTime);
+
+                // The dispatcher sends each car its stops, and every car reports its moves back
+                addCoupling(dispatcher->outCars[i], car->inStop);
+                addCoupling(car->outStatus, dispatcher->inCarStatus);
+            }
+
+#ifdef BINARY_INPUT
+            // Declare and initialize the simulated input file, converted from floorRequestInput.txt by "make checkpoint"
+            auto floorRequestInput = addComponent<shared::BinaryInputStream<int>>("floorRequestInput",(inputFolder + "/floorRequestInput.bin").c_str());
+#else
+            // Declare and initialize the simulated input file (it must exist in the file system before running)
+            auto floorRequestInput = addComponent<cadmium::lib::IEStream<int>>("floorRequestInput",(inputFolder + "/floorRequestInput.txt").c_str());
+#endif
+
+            // Connect the input file to the rest of the simulation with coupling
+            addCoupling(floorRequestInput->out, dispatcher->inRequest);
+        }
+    };
+} // namespace cadmium::elevatorSystem
+
+#endif // __BUILDING_SYSTEM_HPP__
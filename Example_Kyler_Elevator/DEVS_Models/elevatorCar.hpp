@@ -0,0 +1,277 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An atomic DEVS model of one elevator car of buildingSystem.
+ *
+ * The car receives the floors it has to stop at from the elevatorDispatcher and
+ * keeps them in a FloorRequests set. Instead of moving one floor every
+ * floorTravelTime like elevatorMove, the car schedules a single internal transition
+ * for its arrival at the next stop, so a trip across a 40 floor building costs two
+ * transitions. When a stop is requested on the way (a floor the car has not passed
+ * yet), the arrival is brought forward to that floor and the old destination stays
+ * pending.
+ *
+ * The car reports every departure and arrival to the dispatcher on outStatus.
+ */
+
+#ifndef __ELEVATOR_CAR_HPP__
+#define __ELEVATOR_CAR_HPP__
+
+// This is an atomic model, meaning it has its' own internal logic/computation
+// So, it is necessary to include atomic.hpp
+#include <modeling/devs/atomic.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include "floorRequests.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::elevatorSystem {
+
+    // Message sent by a car to the dispatcher each time it leaves or reaches a floor
+    struct CarStatus {
+        int car;      // Index of the car in the building
+        int floor;    // Floor the car is leaving, or has reached
+        int target;   // Next stop of the car (equal to floor when it is stopped)
+        bool moving;  // True when the car is leaving floor for target
+        std::size_t pendingStops; // Stops still to serve after this one
+
+        CarStatus(): car(0), floor(1), target(1), moving(false), pendingStops(0) {}
+        CarStatus(int car, int floor, int target, bool moving, std::size_t pendingStops):
+            car(car), floor(floor), target(target), moving(moving), pendingStops(pendingStops) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const CarStatus& status) {
+        out << "{car: " << status.car << ", floor: " << status.floor << ", target: " << status.target
+            << ", moving: " << status.moving << ", pending: " << status.pendingStops << "}";
+        return out;
+    }
+#endif
+
+    enum class CarPhase : uint8_t {
+        Idle,     // Stopped with the door closed, waiting for a stop
+        Moving,   // Travelling from floor to target
+        DoorOpen  // Stopped at floor with the door open
+    };
+
+    // A class to represent the state of this specific model
+    // All atomic models will have their own state
+    struct ElevatorCarState {
+
+        // sigma is a mandatory variable for atomic models, used to advance the time of the simulation
+        double sigma;
+
+        // Declare model-specific variables
+        CarPhase phase;
+        int floor;          // Floor the car is stopped at, or left from when moving
+        int target;         // Floor the car is moving to
+        Direction direction;
+        double legElapsed;   // Time spent moving since the car left floor
+        FloorRequests stops; // Stops not served yet (excluding target while moving)
+
+        // Set the default values for the state constructor for this specific model
+        ElevatorCarState(): sigma(std::numeric_limits<double>::infinity()), phase(CarPhase::Idle),
+            floor(1), target(1), direction(Direction::Idle), legElapsed(0) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(phase, floor, target, direction);
+            if (phase == CarPhase::Moving) {
+                archive.timeSince(legElapsed);
+            } else {
+                archive(legElapsed);
+            }
+            archive(stops);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    /**
+     * Insertion operator for ElevatorCarState objects, used for the .csv output.
+     *
+     * @param out output stream.
+     * @param state state to be represented in the output stream.
+     * @return output stream with the phase, floor, target and pending stops already inserted.
+     */
+    std::ostream& operator<<(std::ostream &out, const ElevatorCarState& state) {
+        static const char* const phases[] = {"Idle", "Moving", "DoorOpen"};
+        out << ",CarPhase: " << phases[static_cast<int>(state.phase)] << ",CarFloor: " << state.floor
+            << ",CarTarget: " << state.target << ",CarPendingStops: " << state.stops.size();
+        return out;
+    }
+#endif
+
+    // Atomic DEVS model of one elevator car
+    class ElevatorCar : public Atomic<ElevatorCarState> {
+     private:
+
+        /**
+         * Leaves the current floor for the next stop, or goes idle if there is none.
+         * When the next stop is the current floor, the door opens instead.
+         *
+         * @param state reference to the current model state.
+         */
+        void depart(ElevatorCarState& state) const {
+            const int next = state.stops.next(state.floor, state.direction);
+            if (state.stops.empty()) {
+                state.phase = CarPhase::Idle;
+                state.direction = Direction::Idle;
+                state.sigma = std::numeric_limits<double>::infinity();
+            } else if (next == state.floor) {
+                state.stops.remove(next);
+                state.phase = CarPhase::DoorOpen;
+                state.sigma = doorOpenTime;
+            } else {
+                state.stops.remove(next);
+                state.phase = CarPhase::Moving;
+                state.target = next;
+                state.direction = directionTo(state.floor, next);
+                state.legElapsed = 0;
+                state.sigma = std::abs(next - state.floor) * floorTravelTime;
+            }
+        }
+
+     public:
+
+        // Declare ports for the model
+
+        // Input ports
+        Port<int> inStop; // Floors assigned to this car by the dispatcher
+
+        // Output ports
+        Port<CarStatus> outStatus;
+
+        // Declare variables for the model's behaviour
+        const int car;
+        const int floorCount;
+        const double floorTravelTime; // Time taken to move the car by one floor
+        const double doorOpenTime;    // Time the door stays open at each stop
+
+        /**
+         * Constructor function for this atomic model, and its respective state object.
+         *
+         * @param id ID of the new ElevatorCar model object.
+         * @param car index of the car in the building.
+         * @param floorCount number of floors served, numbered from 1.
+         * @param floorTravelTime time in seconds taken to move the car by one floor.
+         * @param doorOpenTime time in seconds the door stays open at each stop.
+         */
+        ElevatorCar(const std::string& id, int car, int floorCount, double floorTravelTime = 2.0, double doorOpenTime = 3.0):
+            Atomic<ElevatorCarState>(id, ElevatorCarState()), car(car), floorCount(floorCount),
+            floorTravelTime(floorTravelTime), doorOpenTime(doorOpenTime) {
+
+            // Initialize ports for the model
+
+            // Input Ports
+            inStop = addInPort<int>("inStop");
+
+            // Output Ports
+            outStatus = addOutPort<CarStatus>("outStatus");
+        }
+
+        /**
+         * The transition function is invoked each time the value of
+         * state.sigma reaches 0.
+         *
+         * The car has either reached its target, in which case the door opens, or
+         * its door is closing, in which case it leaves for the next stop.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(ElevatorCarState& state) const override {
+            if (state.phase == CarPhase::Moving) {
+                state.floor = state.target;
+                state.stops.remove(state.floor);
+                state.phase = CarPhase::DoorOpen;
+                state.sigma = doorOpenTime;
+            } else {
+                depart(state);
+            }
+        }
+
+        /**
+         * The external transition function is invoked each time external data
+         * is sent to an input port for this model.
+         *
+         * In this model, new stops are added to the pending ones. A stop on the way to
+         * the target that the car can still stop at becomes the new target.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(ElevatorCarState& state, double e) const override {
+            if (state.phase == CarPhase::Moving) {
+                state.legElapsed += e;
+            }
+            state.sigma -= e;
+
+            for (const int stop : inStop->getBag()) {
+                if (stop < 1 || stop > floorCount) {
+                    continue;
+                }
+                if (state.phase == CarPhase::Moving) {
+                    const int step = static_cast<int>(state.direction);
+                    const int distance = (stop - state.floor) * step;
+                    const int targetDistance = (state.target - state.floor) * step;
+                    // The car passes the floor at distance d after d * floorTravelTime, so it can
+                    // still stop at the floors it has not passed yet
+                    if (distance < targetDistance && distance * floorTravelTime >= state.legElapsed) {
+                        state.stops.add(state.target);
+                        state.target = stop;
+                        state.sigma = distance * floorTravelTime - state.legElapsed;
+                        continue;
+                    }
+                    if (stop != state.target) {
+                        state.stops.add(stop);
+                    }
+                } else {
+                    // A request for the floor the door is open at keeps the door open for another round
+                    state.stops.add(stop);
+                }
+            }
+
+            // An idle car leaves straight away
+            if (state.phase == CarPhase::Idle && !state.stops.empty()) {
+                state.sigma = 0;
+            }
+        }
+
+        /**
+         * This function outputs any desired state values to their associated ports.
+         *
+         * In this model, it reports the arrival of a moving car, or the departure
+         * (or idling) of a stopped one.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const ElevatorCarState& state) const override {
+            if (state.phase == CarPhase::Moving) {
+                outStatus->addMessage(CarStatus(car, state.target, state.target, false, state.stops.size()));
+            } else {
+                const int next = state.stops.next(state.floor, state.direction);
+                const std::size_t pending = state.stops.size() - (state.stops.empty() ? 0 : 1);
+                outStatus->addMessage(CarStatus(car, state.floor, next, next != state.floor, pending));
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * This function is the same for all models, and does not need to be changed.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const ElevatorCarState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::elevatorSystem
+
+#endif // __ELEVATOR_CAR_HPP__
@@ -0,0 +1,255 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An atomic DEVS model assigning the floor requests of buildingSystem to its cars.
+ *
+ * The dispatcher keeps the last status reported by every car and estimates where
+ * each one is from the time elapsed since. A request goes to the car with the
+ * lowest estimated cost, in floors: the distance to the request when it lies
+ * ahead of the car (or the car is idle), the distance the car still has to cover
+ * before turning around otherwise, plus a penalty for every stop the car has left.
+ * Requests for a floor that is already assigned to a car are not dispatched twice.
+ *
+ * Each car has its own output port, outCars[i], so a car only receives its stops.
+ */
+
+#ifndef __ELEVATOR_DISPATCHER_HPP__
+#define __ELEVATOR_DISPATCHER_HPP__
+
+// This is an atomic model, meaning it has its' own internal logic/computation
+// So, it is necessary to include atomic.hpp
+#include <modeling/devs/atomic.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "elevatorCar.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::elevatorSystem {
+
+    // Last status reported by a car, and when it was received
+    struct CarEstimate {
+        CarStatus status;
+        double since;
+
+        CarEstimate(): status(), since(0) {}
+    };
+
+    // A class to represent the state of this specific model
+    // All atomic models will have their own state
+    struct ElevatorDispatcherState {
+
+        // sigma is a mandatory variable for atomic models, used to advance the time of the simulation
+        double sigma;
+
+        // Declare model-specific variables
+        double clock;                               // Simulation time of the last transition
+        std::vector<CarEstimate> cars;
+        std::vector<int> assignedCar;               // Car serving each floor, -1 if none (index 0 unused)
+        std::vector<std::pair<int, int>> toSend;    // Assignments (car, floor) sent by the next output
+        std::size_t dispatched;                     // Number of requests assigned so far
+
+        // Set the default values for the state constructor for this specific model
+        ElevatorDispatcherState(): sigma(std::numeric_limits<double>::infinity()), clock(0), dispatched(0) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive.timeSince(clock);
+            archive(cars, assignedCar, toSend, dispatched);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    /**
+     * Insertion operator for ElevatorDispatcherState objects, used for the .csv output.
+     *
+     * @param out output stream.
+     * @param state state to be represented in the output stream.
+     * @return output stream with the number of dispatched requests already inserted.
+     */
+    std::ostream& operator<<(std::ostream &out, const ElevatorDispatcherState& state) {
+        out << ",Dispatched: " << state.dispatched << ",ToSend: " << state.toSend.size();
+        return out;
+    }
+#endif
+
+    // Atomic DEVS model of the dispatcher of buildingSystem
+    class ElevatorDispatcher : public Atomic<ElevatorDispatcherState> {
+     private:
+
+        /**
+         * Estimates the number of floors a car has to travel before it can serve a floor.
+         *
+         * @param estimate last status of the car.
+         * @param clock current simulation time.
+         * @param floor requested floor.
+         * @return the estimated cost, in floors.
+         */
+        [[nodiscard]] double cost(const CarEstimate& estimate, double clock, int floor) const {
+            const CarStatus& status = estimate.status;
+            double position = status.floor;
+            if (status.moving) {
+                const double travelled = floorTravelTime > 0 ? (clock - estimate.since) / floorTravelTime
+                                                             : std::numeric_limits<double>::infinity();
+                position += static_cast<int>(directionTo(status.floor, status.target))
+                            * std::min(travelled, static_cast<double>(std::abs(status.target - status.floor)));
+            }
+            double distance;
+            const double ahead = (floor - position) * static_cast<int>(directionTo(status.floor, status.target));
+            if (!status.moving || ahead >= 0) {
+                distance = std::abs(floor - position);
+            } else {
+                distance = std::abs(status.target - position) + std::abs(status.target - floor);
+            }
+            return distance + stopPenalty * static_cast<double>(status.pendingStops + (status.moving ? 1 : 0));
+        }
+
+     public:
+
+        // Declare ports for the model
+
+        // Input ports
+        Port<int> inRequest;          // Floors requested in the building
+        Port<CarStatus> inCarStatus;  // Departures and arrivals of every car
+
+        // Output ports
+        std::vector<Port<int>> outCars; // Stops assigned to each car
+
+        // Declare variables for the model's behaviour
+        const int floorCount;
+        const double floorTravelTime;
+        const double stopPenalty; // Cost of a stop, in floors travelled; 0 without a positive floor travel time
+
+        /**
+         * Constructor function for this atomic model, and its respective state object.
+         *
+         * @param id ID of the new ElevatorDispatcher model object.
+         * @param floorCount number of floors in the building, numbered from 1.
+         * @param carCount number of cars in the building.
+         * @param floorTravelTime time in seconds taken to move a car by one floor.
+         * @param doorOpenTime time in seconds the door of a car stays open at each stop.
+         */
+        ElevatorDispatcher(const std::string& id, int floorCount, int carCount, double floorTravelTime = 2.0, double doorOpenTime = 3.0):
+            Atomic<ElevatorDispatcherState>(id, ElevatorDispatcherState()), floorCount(floorCount),
+            floorTravelTime(floorTravelTime), stopPenalty(floorTravelTime > 0 ? doorOpenTime / floorTravelTime : 0.0) {
+
+            // Initialize ports for the model
+
+            // Input Ports
+            inRequest = addInPort<int>("inRequest");
+            inCarStatus = addInPort<CarStatus>("inCarStatus");
+
+            // Output Ports
+            for (int i = 0; i < carCount; i++) {
+                outCars.push_back(addOutPort<int>("outCar" + std::to_string(i)));
+            }
+
+            // Every car starts idle on the first floor
+            state.cars.resize(carCount);
+            for (int i = 0; i < carCount; i++) {
+                state.cars[i].status.car = i;
+            }
+            state.assignedCar.assign(floorCount + 1, -1);
+        }
+
+        /**
+         * The transition function is invoked each time the value of
+         * state.sigma reaches 0.
+         *
+         * In this model, the assignments have just been sent, so the model goes
+         * passive until the next request.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(ElevatorDispatcherState& state) const override {
+            state.clock += state.sigma;
+            state.toSend.clear();
+            state.sigma = std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * The external transition function is invoked each time external data
+         * is sent to an input port for this model.
+         *
+         * In this model, the estimates of the cars are updated first, then every new
+         * request is assigned to the car with the lowest cost.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(ElevatorDispatcherState& state, double e) const override {
+            state.clock += e;
+            state.sigma -= e;
+
+            for (const CarStatus& status : inCarStatus->getBag()) {
+                if (status.car < 0 || status.car >= static_cast<int>(state.cars.size())) {
+                    continue;
+                }
+                state.cars[status.car].status = status;
+                state.cars[status.car].since = state.clock;
+                // The car is at the floor with its door open, so the floor can be requested again
+                if (!status.moving && state.assignedCar[status.floor] == status.car) {
+                    state.assignedCar[status.floor] = -1;
+                }
+            }
+
+            for (const int floor : inRequest->getBag()) {
+                if (floor < 1 || floor > floorCount || state.assignedCar[floor] != -1 || state.cars.empty()) {
+                    continue;
+                }
+                int best = 0;
+                double bestCost = cost(state.cars[0], state.clock, floor);
+                for (int i = 1; i < static_cast<int>(state.cars.size()); i++) {
+                    const double carCost = cost(state.cars[i], state.clock, floor);
+                    if (carCost < bestCost) {
+                        best = i;
+                        bestCost = carCost;
+                    }
+                }
+                state.assignedCar[floor] = best;
+                state.cars[best].status.pendingStops++;
+                state.toSend.emplace_back(best, floor);
+                state.dispatched++;
+            }
+
+            if (!state.toSend.empty()) {
+                state.sigma = 0;
+            }
+        }
+
+        /**
+         * This function outputs any desired state values to their associated ports.
+         *
+         * In this model, each new stop is sent on the port of its car.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const ElevatorDispatcherState& state) const override {
+            for (const auto& [car, floor] : state.toSend) {
+                outCars[car]->addMessage(floor);
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * This function is the same for all models, and does not need to be changed.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const ElevatorDispatcherState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::elevatorSystem
+
+#endif // __ELEVATOR_DISPATCHER_HPP__
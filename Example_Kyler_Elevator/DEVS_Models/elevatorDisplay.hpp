@@ -0,0 +1,237 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An atomic DEVS model showing the floor the elevator is passing on the LCD.
+ *
+ * In MoveMode::DirectArrival, elevatorMove schedules a single transition for the
+ * arrival of the elevator instead of one per floor, and sends the trip it starts
+ * to this model. The display then works out the floor being passed from the time
+ * elapsed since the departure, and refreshes the LCD every displayPeriod seconds
+ * while the elevator moves. The period is independent from the floor travel time,
+ * so the display can be refreshed at a lower rate than the elevator passes floors.
+ * The model is only added to elevatorSystem when a display period is given.
+ */
+
+#ifndef __ELEVATOR_DISPLAY_HPP__
+#define __ELEVATOR_DISPLAY_HPP__
+
+// This is an atomic model, meaning it has its' own internal logic/computation
+// So, it is necessary to include atomic.hpp
+#include <modeling/devs/atomic.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "../../Shared_Models/lcdCommand.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::elevatorSystem {
+
+    // Trip started by elevatorMove, sent to elevatorDisplay
+    struct ElevatorTrip {
+        double from;            // Position the elevator leaves from, in floors (fractional if it was moving)
+        int to;                 // Floor the elevator moves to
+        double floorTravelTime; // Time taken to move the elevator by one floor
+
+        ElevatorTrip(): from(1), to(1), floorTravelTime(2.0) {}
+        ElevatorTrip(double from, int to, double floorTravelTime): from(from), to(to), floorTravelTime(floorTravelTime) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const ElevatorTrip& trip) {
+        out << "{from: " << trip.from << ", to: " << trip.to << "}";
+        return out;
+    }
+#endif
+
+    /**
+     * Works out where the elevator is during a trip.
+     *
+     * @param trip trip of the elevator.
+     * @param elapsed time since the trip started.
+     * @return the position of the elevator after elapsed seconds, in floors.
+     */
+    inline double tripPosition(const ElevatorTrip& trip, double elapsed) {
+        const double travelled = std::min(std::abs(trip.to - trip.from), elapsed / trip.floorTravelTime);
+        return trip.to > trip.from ? trip.from + travelled : trip.from - travelled;
+    }
+
+    /**
+     * Works out the floor the elevator last passed during a trip.
+     *
+     * @param trip trip of the elevator.
+     * @param elapsed time since the trip started.
+     * @return the floor reached, or last passed, after elapsed seconds.
+     */
+    inline int tripFloor(const ElevatorTrip& trip, double elapsed) {
+        const double position = tripPosition(trip, elapsed);
+        return static_cast<int>(trip.to > trip.from ? std::floor(position) : std::ceil(position));
+    }
+
+    /**
+     * Builds the LCD command showing the destination and current floor.
+     *
+     * @param floorToMove destination floor.
+     * @param floorNum floor the elevator is on, or last passed.
+     * @return LCD command for row 5 of the screen.
+     */
+    inline shared::LcdCommand floorStatusCommand(int floorToMove, int floorNum) {
+        shared::LcdCommand command(0, 5, "DFloor:");
+        command.append(floorToMove).append(" CFloor:").append(floorNum);
+        return command;
+    }
+
+    // A class to represent the state of this specific model
+    // All atomic models will have their own state
+    struct ElevatorDisplayState {
+
+        // sigma is a mandatory variable for atomic models, used to advance the time of the simulation
+        double sigma;
+
+        // Declare model-specific variables
+        ElevatorTrip trip;
+        double elapsed; // Time since the trip started
+        bool moving;
+        int shownFloor; // Floor shown on the LCD
+
+        // Set the default values for the state constructor for this specific model
+        ElevatorDisplayState(): sigma(std::numeric_limits<double>::infinity()), elapsed(0), moving(false), shownFloor(0) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(trip);
+            archive.timeSince(elapsed);
+            archive(moving, shownFloor);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    /**
+     * Insertion operator for ElevatorDisplayState objects, used for the .csv output.
+     *
+     * @param out output stream.
+     * @param state state to be represented in the output stream.
+     * @return output stream with the shown floor and trip already inserted.
+     */
+    std::ostream& operator<<(std::ostream &out, const ElevatorDisplayState& state) {
+        out << ",DisplayFloor: " << state.shownFloor << ",DisplayTrip: " << state.trip << ",DisplayMoving: " << state.moving;
+        return out;
+    }
+#endif
+
+    // Atomic DEVS model of the floor display of the elevator
+    class ElevatorDisplay : public Atomic<ElevatorDisplayState> {
+     private:
+
+        /**
+         * Schedules the next refresh of the LCD, or goes passive if the elevator
+         * arrives first (elevatorMove shows the arrival).
+         *
+         * @param state reference to the current model state.
+         */
+        void scheduleRefresh(ElevatorDisplayState& state) const {
+            const double arrival = std::abs(state.trip.to - state.trip.from) * state.trip.floorTravelTime;
+            state.moving = state.elapsed + displayPeriod < arrival;
+            state.sigma = state.moving ? displayPeriod : std::numeric_limits<double>::infinity();
+        }
+
+     public:
+
+        // Declare ports for the model
+
+        // Input ports
+        shared::BoundedPort<ElevatorTrip, 1> inTrip;
+
+        // Output ports
+        shared::BoundedPort<shared::LcdCommand, 1> lcdStatus;
+
+        // Declare variables for the model's behaviour
+        const double displayPeriod; // Time between two refreshes of the LCD while moving
+
+        /**
+         * Constructor function for this atomic model, and its respective state object.
+         *
+         * @param id ID of the new ElevatorDisplay model object.
+         * @param displayPeriod time in seconds between two refreshes of the LCD while the elevator moves.
+         */
+        ElevatorDisplay(const std::string& id, double displayPeriod):
+            Atomic<ElevatorDisplayState>(id, ElevatorDisplayState()), displayPeriod(displayPeriod) {
+
+            // Initialize ports for the model
+
+            // Input Ports
+            inTrip = addInPort<ElevatorTrip>("inTrip");
+
+            // Output Ports
+            lcdStatus = addOutPort<shared::LcdCommand>("lcdStatus");
+        }
+
+        /**
+         * The transition function is invoked each time the value of
+         * state.sigma reaches 0.
+         *
+         * In this model, the LCD was just refreshed, so the next refresh is scheduled.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(ElevatorDisplayState& state) const override {
+            state.elapsed += state.sigma;
+            state.shownFloor = tripFloor(state.trip, state.elapsed);
+            scheduleRefresh(state);
+        }
+
+        /**
+         * The external transition function is invoked each time external data
+         * is sent to an input port for this model.
+         *
+         * In this model, a new trip restarts the refreshes.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(ElevatorDisplayState& state, double e) const override {
+            state.elapsed += e;
+            state.sigma -= e;
+            for (const auto& trip : inTrip->getBag()) {
+                state.trip = trip;
+                state.elapsed = 0;
+                state.moving = true;
+                state.shownFloor = tripFloor(trip, 0); // elevatorMove shows the departure floor
+                scheduleRefresh(state);
+            }
+        }
+
+        /**
+         * This function outputs any desired state values to their associated ports.
+         *
+         * In this model, the floor being passed is sent to the LCD when it changed.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const ElevatorDisplayState& state) const override {
+            const int floor = tripFloor(state.trip, state.elapsed + state.sigma);
+            if (state.moving && floor != state.shownFloor) {
+                lcdStatus->addMessage(floorStatusCommand(state.trip.to, floor));
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * This function is the same for all models, and does not need to be changed.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const ElevatorDisplayState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::elevatorSystem
+
+#endif // __ELEVATOR_DISPLAY_HPP__
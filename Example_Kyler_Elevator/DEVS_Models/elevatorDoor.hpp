@@ -21,12 +21,50 @@
 // This is an atomic model, meaning it has its' own internal logic/computation
 // So, it is necessary to include atomic.hpp
 #include <modeling/devs/atomic.hpp>
+#include "../../Shared_Models/passivation.hpp"
+#include "../../Shared_Models/lastEmitted.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
+#include "../../Shared_Models/tableMachine.hpp"
 
 #if !defined NO_LOGGING || !defined EMBED
     #include <iostream>
 #endif
 
 namespace cadmium::elevatorSystem {
+
+    // Default configuration of ElevatorDoor, folded into the model at compile time
+    struct ElevatorDoorConfig {
+        static constexpr double pollPeriod = 0.11; // Delay before a change of the door status is sent out
+    };
+
+    // Door positions, rows of elevatorDoorTable. The door status is sent pollPeriod after
+    // the door starts to open or close
+    enum ElevatorDoorPhase : uint8_t {
+        DOOR_OPENING,
+        DOOR_OPEN,
+        DOOR_CLOSING,
+        DOOR_CLOSED
+    };
+
+    enum ElevatorDoorOutput : uint8_t { DOOR_CLOSED_LIGHT };                    // Bit of the blue LED, on while the door is closed
+    enum ElevatorDoorDuration : uint8_t { DOOR_POLL, DOOR_IDLE, DOOR_PASSIVE }; // Indexes of ElevatorDoorModel::durations
+    enum ElevatorDoorEvent : uint8_t {
+        REQUEST_HERE,      // elevatorNum requested the floor the elevator is on
+        REQUEST_ELSEWHERE, // elevatorNum requested a new floor to move to
+        REQUEST_TARGET,    // elevatorNum requested the floor the elevator is already moving to
+        ARRIVED            // elevatorMove reached the floor to move to
+    };
+
+    constexpr shared::MachineTable<4, 4, 3> elevatorDoorTable{{
+        // duration    timeout      outputs                  REQUEST_HERE          REQUEST_ELSEWHERE  REQUEST_TARGET        ARRIVED
+        {DOOR_POLL,    DOOR_OPEN,   0,                       {shared::MACHINE_STAY, DOOR_CLOSING,      DOOR_CLOSING,         shared::MACHINE_STAY}},
+        {DOOR_IDLE,    DOOR_OPEN,   0,                       {shared::MACHINE_STAY, DOOR_CLOSING,      DOOR_CLOSING,         shared::MACHINE_STAY}},
+        {DOOR_POLL,    DOOR_CLOSED, 1u << DOOR_CLOSED_LIGHT, {DOOR_OPENING,         DOOR_CLOSING,      shared::MACHINE_STAY, DOOR_OPENING}},
+        {DOOR_PASSIVE, DOOR_CLOSED, 1u << DOOR_CLOSED_LIGHT, {DOOR_OPENING,         DOOR_CLOSING,      shared::MACHINE_STAY, DOOR_OPENING}}
+    }};
+
+    static_assert(elevatorDoorTable.valid(), "elevatorDoorTable must only reference its rows and the three durations");
+
     // A class to represent the state of this specific model
     // All atomic models will have their own state
     struct ElevatorDoorState {
@@ -37,11 +75,21 @@ namespace cadmium::elevatorSystem {
         // Declare model-specific variables
         int floorNum;
         int floorNumToMove;
-        bool lightOn;
+        shared::MachineRun machine; //Position of the door in elevatorDoorTable, and the door status last sent
         std::string currentStatus; //String used to display current info on elevatorDoor LOG
 
+        //Last floor sent on outFloorToMove, used to skip repeated messages
+        shared::LastEmitted<int> lastFloorNumToMove;
+
         // Set the default values for the state constructor for this specific model
-        ElevatorDoorState(): sigma(0), floorNum(1), floorNumToMove(1), lightOn(false), currentStatus("") {}
+        ElevatorDoorState(): sigma(0), floorNum(1), floorNumToMove(1), machine(DOOR_OPENING), currentStatus("") {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(floorNum, floorNumToMove, machine.current, machine.lastOutputs, machine.sent);
+            archive(currentStatus, lastFloorNumToMove);
+        }
     };
 #if !defined NO_LOGGING || !defined EMBED
     /**
@@ -51,20 +99,21 @@ namespace cadmium::elevatorSystem {
      *
      * In this model, each time the internal transition function is invoked the current
      * output from the out port is listed, followed by the model's current state for
-     * state.lightOn.
+     * the door light, read from elevatorDoorTable.
      *
      * @param out output stream.
      * @param s state to be represented in the output stream.
-     * @return output stream with lightOn already inserted.
+     * @return output stream with the door light already inserted.
      */
     std::ostream& operator<<(std::ostream &out, const ElevatorDoorState& state) {
-        out << ", DoorStatus: " << state.currentStatus << ",DoorLight: " << state.lightOn << ",DoorFloorNum: " << state.floorNum << ",DoorFloorNumToMove: " << state.floorNumToMove;
+        out << ", DoorStatus: " << state.currentStatus << ",DoorLight: " << elevatorDoorTable.output(state.machine, DOOR_CLOSED_LIGHT) << ",DoorFloorNum: " << state.floorNum << ",DoorFloorNumToMove: " << state.floorNumToMove;
         return out;
     }
 #endif
 
-    // Atomic DEVS model of GarageDoor.
-    class ElevatorDoor : public Atomic<ElevatorDoorState> {
+    // Atomic DEVS model of ElevatorDoor, see ElevatorDoorConfig for its configuration
+    template<typename Config = ElevatorDoorConfig>
+    class ElevatorDoorModel : public Atomic<ElevatorDoorState> {
      private:
 
      public:
@@ -72,15 +121,18 @@ namespace cadmium::elevatorSystem {
         // Declare ports for the model
 
         // Input ports
-        Port<int> inElevatorNum;
-        Port<int> inElevatorMove;
+        shared::BoundedPort<int, 1> inElevatorNum;
+        shared::BoundedPort<int, 1> inElevatorMove;
 
         // Output ports
-        Port<int> outFloorToMove;
-        Port<bool> outDoorStatus;
+        shared::BoundedPort<int, 1> outFloorToMove;
+        shared::BoundedPort<bool, 1> outDoorStatus;
 
         // Declare variables for the model's behaviour
-        // (NOT APPLICABLE TO THIS MODEL)
+        static constexpr double pollPeriod = Config::pollPeriod; // Delay before a change of the door status is sent out
+
+        // Time spent in the rows of elevatorDoorTable, indexed by ElevatorDoorDuration
+        static constexpr double durations[3] = {pollPeriod, shared::idleSigma(pollPeriod), std::numeric_limits<double>::infinity()};
 
 
         /**
@@ -91,7 +143,7 @@ namespace cadmium::elevatorSystem {
          *
          * @param id ID of the new GarageDoor model object.
          */
-        ElevatorDoor(const std::string& id): Atomic<ElevatorDoorState>(id, ElevatorDoorState()) {
+        explicit ElevatorDoorModel(const std::string& id): Atomic<ElevatorDoorState>(id, ElevatorDoorState()) {
 
             // Initialize ports for the model
 
@@ -105,12 +157,10 @@ namespace cadmium::elevatorSystem {
 
             outDoorStatus = addOutPort<bool>("outDoorStatus");
 
-            // Initialize variables for the model's behvaiour
-
-            // Set a value for sigma (so it is not 0), this determines how often the
-            // internal transition occurs
+            // Set a value for sigma (so it is not 0), this determines when the
+            // first internal transition occurs
             //state.sigma = std::numeric_limits<double>::infinity(); //EMBED
-            state.sigma = 0.11; //LOG
+            state.sigma = elevatorDoorTable.duration(state.machine.current, durations); //LOG
 
         }
 
@@ -118,23 +168,16 @@ namespace cadmium::elevatorSystem {
          * The transition function is invoked each time the value of
          * state.sigma reaches 0.
          *
-         * In this model, the transition function does nothing.
+         * In this model, the door status has just been sent, so the door moves on to
+         * the next row of elevatorDoorTable: passive once open or closed (or polling
+         * while the door is open when LEGACY_POLLING is defined).
          *
          * @param state reference to the current state of the model.
          */
         void internalTransition(ElevatorDoorState& state) const override {
 
-            if(state.lightOn == true){
-                state.sigma = std::numeric_limits<double>::infinity(); //EMBED
-                //state.currentStatus.append("$");
-
-            }
-            //state.sigma = std::numeric_limits<double>::infinity(); //EMBED
-            else if(state.lightOn == false){
-                state.sigma = 0.11;
-                //state.currentStatus.append("!");
-
-            }
+            state.lastFloorNumToMove.record(state.floorNumToMove);
+            state.sigma = elevatorDoorTable.timeout(state.machine, durations);
 
         }
 
@@ -142,7 +185,9 @@ namespace cadmium::elevatorSystem {
          * The external transition function is invoked each time external data
          * is sent to an input port for this model.
          *
-         * In this Model, GarageDoorState::lightOn is updated if authorization is received.
+         * In this Model, each input is turned into an ElevatorDoorEvent, which moves
+         * the door through elevatorDoorTable. Events that do not open or close the door
+         * leave sigma unchanged.
          *
          * @param state reference to the current model state.
          * @param e time elapsed since the last state transition function was triggered.
@@ -157,56 +202,50 @@ namespace cadmium::elevatorSystem {
                 // The getBag() function is used to get the next input value.
                 for(int x : inElevatorNum->getBag()){
 
-                    //Received floor input equals the floor num this atomic model currently holds. So open the door (lightOn = false)
+                    //Received floor input equals the floor num this atomic model currently holds. So open the door
                     if (x==state.floorNum){
-                        state.lightOn = false;
-                        state.sigma = 0.11;
-                        //state.currentStatus.append("#");
-
+                        elevatorDoorTable.react(state.machine, REQUEST_HERE, state.sigma, durations);
+                    }
+                    //The elevator will have to move, so the door will close
+                    else if (x==state.floorNumToMove){
+                        elevatorDoorTable.react(state.machine, REQUEST_TARGET, state.sigma, durations);
                     }
                     else{
-                        //Received floor input does not equal the floor num this atomic model currently holds
-                        //This means the elevator will have to move, so the door will close (lightOn = true)
-                        state.lightOn = true;
                         state.floorNumToMove = x;
-                        //state.currentStatus.append("?");
+                        elevatorDoorTable.react(state.machine, REQUEST_ELSEWHERE, state.sigma, durations);
                     }
-                    //state.sigma = 0.12;
                 }
             }
 
-
             //Receive input from elevatorMove, the current floor number the elevatorMove model is on
             if(!inElevatorMove->empty()){
 
                 for(int y : inElevatorMove->getBag()){
                     state.floorNum = y;
                 }
-            }
 
-            //Receive input from elevatorMove, the current status of the buzzer indicating movement
-            //if(!inElevatorBuzz->empty()){
-                //for(int z : inElevatorBuzz->getBag()){
-                    //.buzzer = z;
-                    //If the current floorNum is equal to floorNumToMove and the buzzer is off, indicates the elevator has stopped moving
-
-                //}
-            //}
+                // elevatorNum no longer re-sends the requested floor while passive, so the door
+                // opens on its own once elevatorMove reports that the requested floor was reached
+                if(shared::passiveModels && state.floorNum == state.floorNumToMove){
+                    elevatorDoorTable.react(state.machine, ARRIVED, state.sigma, durations);
+                }
+            }
         }
 
         /**
          * This function outputs any desired state values to their associated ports.
          *
-         * In this model, it outputs the already processed GarageDoorState::lightOn
-         * via the outLED port.  The I/O model that receives the message (digitalOutput)
-         * will update the status of the LED.
+         * In this model, it outputs the door status of elevatorDoorTable via the
+         * outDoorStatus port, and the floor to move to via outFloorToMove.
          *
          * @param state reference to the current model state.
          */
         void output(const ElevatorDoorState& state) const override {
 
-            outDoorStatus->addMessage(state.lightOn);
-            outFloorToMove->addMessage(state.floorNumToMove);
+            if(elevatorDoorTable.changedOutputs(state.machine) & (1u << DOOR_CLOSED_LIGHT)){
+                outDoorStatus->addMessage(elevatorDoorTable.output(state.machine, DOOR_CLOSED_LIGHT));
+            }
+            shared::emitIfChanged(outFloorToMove, state.lastFloorNumToMove, state.floorNumToMove);
 
         }
 
@@ -222,6 +261,8 @@ namespace cadmium::elevatorSystem {
             return state.sigma;
         }
     };
+
+    using ElevatorDoor = ElevatorDoorModel<>;
 } // namespace cadmium::elevatorDoorSystem
 
 #endif // __ELEVATOR_DOOR_HPP__
@@ -0,0 +1,23 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Response time probes of the Elevator example, compiled only with LATENCY_PROBES
+ * (see Simulation/latency.hpp).
+ *
+ * requestToBuzzer runs from the button being pressed, when the input model emits it,
+ * to the buzzer receiving its duty cycle as the elevator leaves. It is taken by the
+ * LatencyProbe models of elevatorSystem (see Shared_Models/latencyProbes.hpp), and
+ * does not count the time the door is modeled to take to close.
+ */
+
+#ifndef __ELEVATOR_LATENCY_HPP__
+#define __ELEVATOR_LATENCY_HPP__
+
+#include "../../Simulation/latency.hpp"
+
+namespace cadmium::elevatorSystem {
+    LATENCY_SPAN(requestToBuzzer);
+} // namespace cadmium::elevatorSystem
+
+#endif // __ELEVATOR_LATENCY_HPP__
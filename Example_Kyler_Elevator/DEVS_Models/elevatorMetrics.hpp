@@ -0,0 +1,22 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Online metrics of the Elevator example, compiled only with ONLINE_METRICS
+ * (see Simulation/metrics.hpp).
+ *
+ * elevatorWait is the time from elevatorNum sending a floor request, when the
+ * button is pressed, to elevatorDoor turning the closed-door light off as the door
+ * opens, measured by the waitObserver of elevatorSystem.
+ */
+
+#ifndef __ELEVATOR_METRICS_HPP__
+#define __ELEVATOR_METRICS_HPP__
+
+#include "../../Simulation/metrics.hpp"
+
+namespace cadmium::elevatorSystem {
+    METRIC_SUMMARY(elevatorWait, "s");
+} // namespace cadmium::elevatorSystem
+
+#endif // __ELEVATOR_METRICS_HPP__
@@ -9,6 +9,11 @@
  * below or above, the stored value will be incremented by one. Once the stored value
  * is equivalent to the input value, the elevator will stop "moving"
  *
+ * In MoveMode::DirectArrival, the arrival time is computed from the distance to the
+ * floor instead, and a single internal transition is scheduled for the arrival, so
+ * the cost of a move no longer depends on the number of floors travelled. The trip
+ * is sent on outTrip for an elevatorDisplay model to show the floors passed.
+ *
  */
 
 
@@ -18,12 +23,48 @@
 // This is an atomic model, meaning it has its' own internal logic/computation
 // So, it is necessary to include atomic.hpp
 #include <modeling/devs/atomic.hpp>
+#include "../../Shared_Models/passivation.hpp"
+#include "../../Shared_Models/lastEmitted.hpp"
+#include "../../Shared_Models/recentEvents.hpp"
+#include "../../Shared_Models/lcdCommand.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
+#include "elevatorDisplay.hpp"
 
 #if !defined NO_LOGGING || !defined EMBED
     #include <iostream>
 #endif
 
 namespace cadmium::elevatorSystem {
+
+    enum class MoveMode : uint8_t {
+        PerFloor,     // One internal transition every floorTravelTime while moving (original behaviour)
+        DirectArrival // One internal transition for the departure and one for the arrival
+    };
+
+    // Duty cycle sent to the buzzer while the elevator moves
+    constexpr int buzzerOnDuty = 2;
+
+    // Default travel time of the elevator, folded into ElevatorMove at compile time
+    struct ElevatorMoveTimings {
+        static constexpr double floorTravelTime = 2.0; // Time in seconds taken to move the elevator by one floor
+    };
+
+    // Travel time given to the constructor instead, for the parameter sweeps (see sweep.cpp)
+    struct RuntimeElevatorMoveTimings {};
+
+    // Travel time used by ElevatorMoveModel: constant of Timings, or field set by the constructor
+    template<typename Timings>
+    struct ElevatorMoveDurations {
+        static constexpr double floorTravelTime = Timings::floorTravelTime;
+    };
+
+    template<>
+    struct ElevatorMoveDurations<RuntimeElevatorMoveTimings> {
+        const double floorTravelTime;
+
+        explicit ElevatorMoveDurations(double floorTravelTime): floorTravelTime(floorTravelTime) {}
+    };
+
     // A class to represent the state of this specific model
     // All atomic models will have their own state
     struct ElevatorMoveState {
@@ -36,12 +77,41 @@ namespace cadmium::elevatorSystem {
         int floorToMove;
         int buzzerDuty;
 
-        std::string currentStatus; //String used to display current info on the garage door
+        // Used in MoveMode::DirectArrival only
+        bool departing;     // The next output starts a trip from tripFrom to floorToMove
+        bool moving;        // The next internal transition is the arrival at floorToMove
+        double tripFrom;    // Position the current trip started from, in floors
+        double tripElapsed; // Time since the current trip started
+
+        shared::LcdCommand currentStatus; //LCD command used to display current info on the elevator
+
+#if !defined NO_LOGGING || !defined EMBED
+        shared::RecentEvents<16> currentStatuss; //Most recent floor requests, displayed on elevatorMove LOG
+#endif
 
-        std::string currentStatuss;
+        //Last values sent on the output ports, used to skip repeated messages
+        shared::LastEmitted<int> lastFloorNum;
+        shared::LastEmitted<int> lastBuzzerDuty;
+        shared::LastEmitted<shared::LcdCommand> lastStatus;
 
         // Set the default values for the state constructor for this specific model
-        ElevatorMoveState(): sigma(0), floorNum(1), floorToMove(1), buzzerDuty(0), currentStatuss("")  {}
+        ElevatorMoveState(): sigma(0), floorNum(1), floorToMove(1), buzzerDuty(0),
+            departing(false), moving(false), tripFrom(1), tripElapsed(0) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(floorNum, floorToMove, buzzerDuty, departing, moving, tripFrom);
+            if (moving) {
+                archive.timeSince(tripElapsed);
+            } else {
+                archive(tripElapsed);
+            }
+            archive(currentStatus, lastFloorNum, lastBuzzerDuty, lastStatus);
+#if !defined NO_LOGGING || !defined EMBED
+            archive(currentStatuss);
+#endif
+        }
     };
 #if !defined NO_LOGGING || !defined EMBED
     /**
@@ -63,25 +133,65 @@ namespace cadmium::elevatorSystem {
     }
 #endif
 
-    // Atomic DEVS model of GarageDoor.
-    class ElevatorMove : public Atomic<ElevatorMoveState> {
+    // Atomic DEVS model of ElevatorMove, see ElevatorMoveTimings for its travel time
+    template<typename Timings = ElevatorMoveTimings>
+    class ElevatorMoveModel : public Atomic<ElevatorMoveState>, public ElevatorMoveDurations<Timings> {
      private:
 
+        // Trip the elevator is on in MoveMode::DirectArrival
+        [[nodiscard]] ElevatorTrip currentTrip(const ElevatorMoveState& state) const {
+            return ElevatorTrip(state.tripFrom, state.floorToMove, floorTravelTime);
+        }
+
+        /**
+         * Transitions of MoveMode::DirectArrival, see internalTransition.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void directInternalTransition(ElevatorMoveState& state) const {
+            state.lastFloorNum.record(state.floorNum);
+            state.lastBuzzerDuty.record(state.buzzerDuty);
+            state.lastStatus.record(state.currentStatus);
+
+            if (state.departing) {
+                // The departure was just sent, schedule the arrival
+                state.departing = false;
+                state.moving = true;
+                state.tripElapsed = 0;
+                state.sigma = std::abs(state.floorToMove - state.tripFrom) * floorTravelTime;
+            } else if (state.moving) {
+                // The arrival was just sent by output()
+                state.moving = false;
+                state.floorNum = state.floorToMove;
+                state.buzzerDuty = 0;
+                state.currentStatus = floorStatus(state);
+                state.lastFloorNum.record(state.floorNum);
+                state.lastBuzzerDuty.record(state.buzzerDuty);
+                state.lastStatus.record(state.currentStatus);
+                state.sigma = shared::idleSigma(floorTravelTime);
+            } else {
+                state.sigma = shared::idleSigma(floorTravelTime);
+            }
+        }
+
      public:
 
         // Declare ports for the model
 
         // Input ports
-        Port<int> inMoveFloor;
+        shared::BoundedPort<int, 1> inMoveFloor;
 
         // Output ports
-        Port<int> outMoveFloor;
-        Port<int> outMoveBuzzer;
+        shared::BoundedPort<int, 1> outMoveFloor;
+        shared::BoundedPort<int, 1> outMoveBuzzer;
 
-        Port<std::string> lcdStatus;
+        shared::BoundedPort<shared::LcdCommand, 6> lcdStatus; // The 5 rows queued by the constructor, then one per output
+
+        shared::BoundedPort<ElevatorTrip, 1> outTrip; // Trips started in MoveMode::DirectArrival, for elevatorDisplay
 
         // Declare variables for the model's behaviour
-        // (NOT APPLICABLE TO THIS MODEL)
+        using ElevatorMoveDurations<Timings>::floorTravelTime; // Time taken to move the elevator by one floor
+        const MoveMode mode;
 
 
         /**
@@ -91,8 +201,12 @@ namespace cadmium::elevatorSystem {
          * are created, using the same id.
          *
          * @param id ID of the new GarageDoor model object.
+         * @param mode whether the elevator moves one floor per transition, or straight to its destination.
+         * @param times with RuntimeElevatorMoveTimings only, the time in seconds taken to move the elevator by one floor.
          */
-        ElevatorMove(const std::string& id): Atomic<ElevatorMoveState>(id, ElevatorMoveState()) {
+        template<typename... Times>
+        explicit ElevatorMoveModel(const std::string& id, MoveMode mode = MoveMode::PerFloor, Times... times):
+            Atomic<ElevatorMoveState>(id, ElevatorMoveState()), ElevatorMoveDurations<Timings>{times...}, mode(mode) {
 
             // Initialize ports for the model
 
@@ -103,50 +217,73 @@ namespace cadmium::elevatorSystem {
             outMoveFloor = addOutPort<int>("outMoveFloor");
             outMoveBuzzer = addOutPort<int>("outMoveBuzzer");
 
-            lcdStatus = addOutPort<std::string>("lcdStatus");
-
+            lcdStatus = addOutPort<shared::LcdCommand>("lcdStatus");
 
-            // Initialize variables for the model's behvaiour
-            // (NOT APPLICABLE TO THIS MODEL)
+            outTrip = addOutPort<ElevatorTrip>("outTrip");
 
-
-            // Set a value for sigma (so it is not 0), this determines how often the
-            // internal transition occurs
-            state.sigma = 2.0; //EMBED
+            // Set a value for sigma (so it is not 0), this determines when the
+            // first internal transition occurs
+            state.sigma = floorTravelTime; //EMBED
 
             //Initial string display on lcd screen
-            state.currentStatus = "BSP_LCD_DrawString(0,0,Elevator V1.30,LCD_WHITE)";
-            lcdStatus->addMessage(state.currentStatus);
-            state.currentStatus = "BSP_LCD_DrawString(0,1,TL=1 TR=2,LCD_WHITE)";
-            lcdStatus->addMessage(state.currentStatus);
-            state.currentStatus = "BSP_LCD_DrawString(0,2,BL=3 BR=4,LCD_WHITE)";
-            lcdStatus->addMessage(state.currentStatus);
-            state.currentStatus = "BSP_LCD_DrawString(0,3,TopButtonInput,LCD_WHITE)";
-            lcdStatus->addMessage(state.currentStatus);
-            state.currentStatus = "BSP_LCD_DrawString(0,5,DFloor:" + std::to_string(state.floorToMove) + " CFloor:" + std::to_string(state.floorNum) + ",LCD_WHITE)";
+            lcdStatus->addMessage(shared::LcdCommand(0, 0, "Elevator V1.30"));
+            lcdStatus->addMessage(shared::LcdCommand(0, 1, "TL=1 TR=2"));
+            lcdStatus->addMessage(shared::LcdCommand(0, 2, "BL=3 BR=4"));
+            lcdStatus->addMessage(shared::LcdCommand(0, 3, "TopButtonInput"));
+            state.currentStatus = floorStatus(state);
             lcdStatus->addMessage(state.currentStatus);
+            state.lastStatus.record(state.currentStatus);
+        }
+
+        /**
+         * Builds the LCD command showing the destination and current floor.
+         *
+         * @param state reference to the current model state.
+         * @return LCD command for row 5 of the screen.
+         */
+        static shared::LcdCommand floorStatus(const ElevatorMoveState& state) {
+            return floorStatusCommand(state.floorToMove, state.floorNum);
         }
 
         /**
          * The transition function is invoked each time the value of
          * state.sigma reaches 0. sigma is 2.0, meaning every 2 seconds
          *
+         * Once the elevator is standing on floorToMove and the buzzer has been turned
+         * off, the model goes passive until a new floor is requested (or keeps polling
+         * when LEGACY_POLLING is defined).
+         *
+         * In MoveMode::DirectArrival, the transition either follows the departure of the
+         * elevator, and schedules its arrival, or follows its arrival.
          *
          * @param state reference to the current state of the model.
          */
         void internalTransition(ElevatorMoveState& state) const override {
 
+            if (mode == MoveMode::DirectArrival) {
+                directInternalTransition(state);
+                return;
+            }
+
+            state.lastFloorNum.record(state.floorNum);
+            state.lastBuzzerDuty.record(state.buzzerDuty);
+            state.lastStatus.record(state.currentStatus);
+
+            // The last output already reported the elevator stopped with the buzzer off
+            const bool stopped = state.floorNum == state.floorToMove && state.buzzerDuty == 0;
+            state.sigma = stopped ? shared::idleSigma(floorTravelTime) : floorTravelTime;
+
             //TEST if internalTransition gets invoked
             if(state.floorNum < state.floorToMove){
-                state.buzzerDuty = 2;
+                state.buzzerDuty = buzzerOnDuty;
                 state.floorNum += 1;
-                state.currentStatus = "BSP_LCD_DrawString(0,5,DFloor:" + std::to_string(state.floorToMove) + " CFloor:" + std::to_string(state.floorNum) + ",LCD_WHITE)";
+                state.currentStatus = floorStatus(state);
                 //state.currentStatuss.append("U "); //LOG
             }
             else if(state.floorNum > state.floorToMove){
-                state.buzzerDuty = 2;
+                state.buzzerDuty = buzzerOnDuty;
                 state.floorNum -= 1;
-                state.currentStatus = "BSP_LCD_DrawString(0,5,DFloor:" + std::to_string(state.floorToMove) + " CFloor:" + std::to_string(state.floorNum) + ",LCD_WHITE)";
+                state.currentStatus = floorStatus(state);
                 //state.currentStatuss.append("D "); //LOG
             }
             else if(state.floorNum == state.floorToMove){
@@ -159,17 +296,49 @@ namespace cadmium::elevatorSystem {
          * The external transition function is invoked each time external data
          * is sent to an input port for this model.
          *
+         * In MoveMode::DirectArrival, a new floor makes the elevator leave for it straight
+         * away, from wherever it is if it was already moving.
+         *
          * @param state reference to the current model state.
          * @param e time elapsed since the last state transition function was triggered.
          * @param x reference to the model input port set.
          */
         void externalTransition(ElevatorMoveState& state, double e) const override {
 
+            if (mode == MoveMode::DirectArrival) {
+                // Position of the elevator now, in case it is stopped halfway by a new floor
+                if (state.moving) {
+                    state.tripElapsed += e;
+                }
+                const double position = state.moving ? tripPosition(currentTrip(state), state.tripElapsed) : state.floorNum;
+                const int passedFloor = state.moving ? tripFloor(currentTrip(state), state.tripElapsed) : state.floorNum;
+                state.sigma -= e;
+
+                const int previousFloorToMove = state.floorToMove;
+                for(int x : inMoveFloor->getBag()){
+                    if(state.floorToMove != x){
+                        state.floorToMove = x;
+                        RECORD_EVENT(state.currentStatuss, "IN:", x); //LOG
+                    }
+                }
+                if (state.floorToMove != previousFloorToMove) {
+                    state.floorNum = passedFloor;
+                    state.tripFrom = position;
+                    state.moving = false;
+                    state.departing = true;
+                    state.buzzerDuty = buzzerOnDuty;
+                    state.currentStatus = floorStatus(state);
+                    state.sigma = 0;
+                }
+                return;
+            }
+
             if(!inMoveFloor->empty()){
                 for(int x : inMoveFloor->getBag()){
                     if(state.floorToMove != x){
                         state.floorToMove = x;
-                        state.currentStatuss.append("IN:" + std::to_string(x)); //LOG
+                        RECORD_EVENT(state.currentStatuss, "IN:", x); //LOG
+                        state.sigma = floorTravelTime;
                     }
                 }
             }
@@ -186,9 +355,20 @@ namespace cadmium::elevatorSystem {
          */
         void output(const ElevatorMoveState& state) const override {
 
-            outMoveFloor->addMessage(state.floorNum);
-            outMoveBuzzer->addMessage(state.buzzerDuty);
-            lcdStatus->addMessage(state.currentStatus);
+            if (state.moving) {
+                // Arrival in MoveMode::DirectArrival
+                shared::emitIfChanged(outMoveFloor, state.lastFloorNum, state.floorToMove);
+                shared::emitIfChanged(outMoveBuzzer, state.lastBuzzerDuty, 0);
+                shared::emitIfChanged(lcdStatus, state.lastStatus, floorStatusCommand(state.floorToMove, state.floorToMove));
+                return;
+            }
+            if (state.departing) {
+                outTrip->addMessage(currentTrip(state));
+            }
+
+            shared::emitIfChanged(outMoveFloor, state.lastFloorNum, state.floorNum);
+            shared::emitIfChanged(outMoveBuzzer, state.lastBuzzerDuty, state.buzzerDuty);
+            shared::emitIfChanged(lcdStatus, state.lastStatus, state.currentStatus);
 
         }
 
@@ -204,6 +384,9 @@ namespace cadmium::elevatorSystem {
             return state.sigma;
         }
     };
+
+    using ElevatorMove = ElevatorMoveModel<>;
+    using RuntimeElevatorMove = ElevatorMoveModel<RuntimeElevatorMoveTimings>;
 } // namespace cadmium::ElevatorSystem
 
 #endif // __ELEVATOR_MOVE_HPP__
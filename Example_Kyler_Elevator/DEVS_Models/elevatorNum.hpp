@@ -27,12 +27,24 @@
 // This is an atomic model, meaning it has its' own internal logic/computation
 // So, it is necessary to include atomic.hpp
 #include <modeling/devs/atomic.hpp>
+#include "../../Shared_Models/passivation.hpp"
+#include "../../Shared_Models/lastEmitted.hpp"
+#include "../../Shared_Models/recentEvents.hpp"
+#include "../../Shared_Models/quadrantDecoder.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
 
 #if !defined NO_LOGGING || !defined EMBED
     #include <iostream>
 #endif
 
 namespace cadmium::elevatorSystem {
+
+    // Default configuration of ElevatorNum, folded into the model at compile time
+    struct ElevatorNumConfig {
+        static constexpr double pollPeriod = 0.11;   // Delay before a newly selected floor is sent to elevatorDoor
+        using AxisZones = shared::JoystickAxisZones; // Joystick zones selecting the floors
+    };
+
     // A class to represent the state of this specific model
     // All atomic models will have their own state
     struct ElevatorNumState {
@@ -47,10 +59,23 @@ namespace cadmium::elevatorSystem {
 
         bool doorStatus; //Variable to keep track of the doors status
 
-        std::string currentStatus; //String used to display current info on elevatorNum LOG
+#if !defined NO_LOGGING || !defined EMBED
+        shared::RecentEvents<16> currentStatus; //Most recent floor inputs, displayed on elevatorNum LOG
+#endif
+
+        shared::LastEmitted<int> lastFloorNum; //Last floor number sent, used to skip repeated messages
 
         // Set the default values for the state constructor for this specific model
-        ElevatorNumState(): sigma(0), xCoordinate(0), yCoordinate(0), floorNum(1), doorStatus(false), currentStatus(""){}
+        ElevatorNumState(): sigma(0), xCoordinate(0), yCoordinate(0), floorNum(1), doorStatus(false){}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(xCoordinate, yCoordinate, floorNum, doorStatus, lastFloorNum);
+#if !defined NO_LOGGING || !defined EMBED
+            archive(currentStatus);
+#endif
+        }
     };
 
 #if !defined NO_LOGGING || !defined EMBED
@@ -72,25 +97,38 @@ namespace cadmium::elevatorSystem {
     }
 #endif
 
-    // Atomic DEVS model of GarageLock
-    class ElevatorNum : public Atomic<ElevatorNumState> {
+    // Atomic DEVS model of ElevatorNum, see ElevatorNumConfig for its configuration
+    template<typename Config = ElevatorNumConfig>
+    class ElevatorNumModel : public Atomic<ElevatorNumState> {
      private:
 
+        // Floor selected by each joystick position, following the diagram above (0: no floor)
+        static constexpr shared::QuadrantDecoder<typename Config::AxisZones, typename Config::AxisZones> floorButtons{{
+            {3, 0, 4},  // Y low
+            {0, 0, 0},  // Y centre
+            {1, 0, 2}   // Y high
+        }};
+
+        static_assert(floorButtons.decode(0, 1023) == 1 && floorButtons.decode(1023, 1023) == 2
+                      && floorButtons.decode(0, 0) == 3 && floorButtons.decode(1023, 0) == 4
+                      && floorButtons.decode(500, 1023) == 0, "floorButtons must follow the diagram");
+
      public:
 
         // Declare ports for the model
         // Input ports
-        Port<int> inX;
-        Port<int> inY;
-        Port<bool> inInput;
+        shared::BoundedPort<int, 1> inX;
+        shared::BoundedPort<int, 1> inY;
+        shared::BoundedPort<bool, 1> inInput;
 
         //Get input from elevatorDoor of status of Door
-        Port<bool> inDoorStatus;
+        shared::BoundedPort<bool, 1> inDoorStatus;
 
         // Output ports
-        Port<int> out;
+        shared::BoundedPort<int, 1> out;
 
-        // (NOT APPLICABLE FOR THIS MODEL) Declare variables for the model's behaviour
+        // Declare variables for the model's behaviour
+        static constexpr double pollPeriod = Config::pollPeriod; // Delay before a newly selected floor is sent to elevatorDoor
 
         /**
          * Constructor function for this atomic model, and its respective state object.
@@ -100,7 +138,7 @@ namespace cadmium::elevatorSystem {
          *
          * @param id ID of the new GarageLock model object.
          */
-        ElevatorNum(const std::string& id): Atomic<ElevatorNumState>(id, ElevatorNumState()) {
+        explicit ElevatorNumModel(const std::string& id): Atomic<ElevatorNumState>(id, ElevatorNumState()) {
 
             // Initialize ports for the model
 
@@ -113,22 +151,24 @@ namespace cadmium::elevatorSystem {
             // Output ports
             out = addOutPort<int>("out");
 
-            // Set a value for sigma (so it is not 0), this determines how often the
-            // internal transition occurs
-            state.sigma = 0.11;
+            // Set a value for sigma (so it is not 0), this determines when the
+            // first internal transition occurs
+            state.sigma = pollPeriod;
         }
 
         /**
          * The transition function is invoked each time the value of
          * state.sigma reaches 0.
          *
-         * In this model, it updates the GarageLock state authorized
-         * to false if it is true.
+         * In this model, the selected floor has just been sent, so the model goes
+         * passive until a new floor is selected (or keeps polling when
+         * LEGACY_POLLING is defined).
          *
          * @param state reference to the current state of the model.
          */
         void internalTransition(ElevatorNumState& state) const override {
-
+            state.lastFloorNum.record(state.floorNum);
+            state.sigma = shared::idleSigma(pollPeriod);
         }
 
         /**
@@ -144,6 +184,8 @@ namespace cadmium::elevatorSystem {
          */
         void externalTransition(ElevatorNumState& state, double e) const override {
 
+            const int previousFloorNum = state.floorNum;
+
             // First check if there are un-handled inputs for the "in" port
             if(!inInput->empty()){
 
@@ -159,26 +201,15 @@ namespace cadmium::elevatorSystem {
                             // If the button (associated with the in port) was pressed, then the
                             // x and y coordinates determine the entered password digit
 
-                            if ((state.xCoordinate < 400)&&(state.yCoordinate > 600)&&(state.floorNum != 1)){
-                                state.floorNum = 1;
-                                state.currentStatus.append("1 ");
-
-                            } else if ((state.xCoordinate > 600)&&(state.yCoordinate > 600)&&(state.floorNum != 2)){
-                                state.floorNum = 2;
-                                state.currentStatus.append("2 ");
-
-                            } else if ((state.xCoordinate < 400)&&(state.yCoordinate < 400)&&(state.floorNum != 3)){
-                                state.floorNum = 3;
-                                state.currentStatus.append("3 ");
-
-                            } else if ((state.xCoordinate > 600)&&(state.yCoordinate < 400)&&(state.floorNum != 4)){
-                                state.floorNum = 4;
-                                state.currentStatus.append("4 ");
+                            const int floor = floorButtons.decode(state.xCoordinate, state.yCoordinate);
+                            if ((floor != 0)&&(state.floorNum != floor)){
+                                state.floorNum = floor;
+                                RECORD_EVENT(state.currentStatus, "", floor, " ");
                             }
                         }
                     }
                     else{
-                        state.currentStatus.append("DC ");
+                        RECORD_EVENT(state.currentStatus, "DC ");
 
                     }
                 }
@@ -206,6 +237,11 @@ namespace cadmium::elevatorSystem {
                     //state.currentStatus.append("Dor ");
                 }
             }
+
+            // Only schedule an output when a new floor was selected
+            if(state.floorNum != previousFloorNum){
+                state.sigma = pollPeriod;
+            }
         }
 
         /**
@@ -219,7 +255,7 @@ namespace cadmium::elevatorSystem {
          */
         void output(const ElevatorNumState& state) const override {
 
-            out->addMessage(state.floorNum);
+            shared::emitIfChanged(out, state.lastFloorNum, state.floorNum);
 
         }
 
@@ -235,6 +271,8 @@ namespace cadmium::elevatorSystem {
             return state.sigma;
         }
     };
+
+    using ElevatorNum = ElevatorNumModel<>;
 } // namespace cadmium::elevatorNumSystem
 
 #endif // __ELEVATOR_NUM_HPP__
@@ -41,10 +41,23 @@
     #include "../../IO_Models/digitalOutput.hpp"
     #include "../../IO_Models/joystickInput.hpp"
     #include "../../IO_Models/lcdOutput.hpp"
+    #include "../../IO_Models/lcdCommandOutput.hpp"
     #include "../../IO_Models/lightSensorInput.hpp"
     #include "../../IO_Models/microphoneInput.hpp"
     #include "../../IO_Models/pwmOutput.hpp"
     #include "../../IO_Models/temperatureSensorInput.hpp"
+    // Nothing wakes the interrupt-driven inputs without LowPowerRootCoordinator, so they poll then
+    #if !defined BUSY_WAIT && !defined LEGACY_POLLING
+        #include "../../IO_Models/digitalInterruptInput.hpp"
+        #include "../../IO_Models/joystickInterruptInput.hpp"
+    #endif
+    #if defined LATENCY_PROBES || defined PROFILE_TRANSITIONS || defined ONLINE_METRICS
+        #include "../../Shared_Models/probeReporter.hpp"
+    #endif
+#elif defined MERGED_INPUT
+    #include "../../Shared_Models/traceInput.hpp"
+#elif defined BINARY_INPUT
+    #include "../../Shared_Models/binaryInputStream.hpp"
 #else
     #include <lib/iestream.hpp>
 #endif
@@ -53,16 +66,56 @@
 #include <elevatorNum.hpp>
 #include <elevatorDoor.hpp>
 #include <elevatorMove.hpp>
+#include <elevatorDisplay.hpp>
+#include "../../Simulation/transitionProfiler.hpp"
+#include "../../Shared_Models/metricObservers.hpp"
+#include "elevatorMetrics.hpp"
+#include "../../Shared_Models/latencyProbes.hpp"
+#include "elevatorLatency.hpp"
 
 namespace cadmium::elevatorSystem {
     class elevatorSystem : public Coupled {
         public:
-        elevatorSystem(const std::string& id): Coupled(id){
+        /**
+         * Elevator moving one floor every 2 seconds (see ElevatorMoveTimings), known at compile time, as built by main.cpp.
+         *
+         * @param id ID of the system.
+         * @param inputFolder folder holding the simulated input files (simulation only).
+         */
+        explicit elevatorSystem(const std::string& id, const std::string& inputFolder = "."): Coupled(id){
+            build<ElevatorMove>(inputFolder, MoveMode::PerFloor, 0);
+        }
+
+        /**
+         * System with a travel time chosen at run time, e.g. by the parameter sweeps.
+         *
+         * @param id ID of the system.
+         * @param floorTravelTime time in seconds taken to move the elevator by one floor.
+         * @param inputFolder folder holding the simulated input files (simulation only).
+         * @param moveMode whether elevatorMove moves one floor per transition, or straight to the requested floor.
+         * @param displayPeriod with MoveMode::DirectArrival, time in seconds between two refreshes of the floor
+         *                      shown on the LCD while moving (0 to only show the departure and arrival).
+         */
+        elevatorSystem(const std::string& id, double floorTravelTime, const std::string& inputFolder = ".",
+                       MoveMode moveMode = MoveMode::PerFloor, double displayPeriod = 0): Coupled(id){
+            build<RuntimeElevatorMove>(inputFolder, moveMode, displayPeriod, floorTravelTime);
+        }
+
+        private:
+        // Adds the models of the system, with Move as elevatorMove, built from the mode and moveTimes
+        template<typename Move, typename... MoveTimes>
+        void build(const std::string& inputFolder, MoveMode moveMode, double displayPeriod, MoveTimes... moveTimes) {
 
             // Declare and initialize all controller models (non-input/output)
-            auto elevatorNum = addComponent<ElevatorNum>("elevatorNum");
-            auto elevatorDoor = addComponent<ElevatorDoor>("elevatorDoor");
-            auto elevatorMove = addComponent<ElevatorMove>("elevatorMove");
+            auto elevatorNum = addComponent<Profiled<ElevatorNum>>("elevatorNum");
+            auto elevatorDoor = addComponent<Profiled<ElevatorDoor>>("elevatorDoor");
+            auto elevatorMove = addComponent<Profiled<Move>>("elevatorMove", moveMode, moveTimes...);
+
+            // The floors passed are only shown by a separate display model when the elevator moves straight to its destination
+            std::shared_ptr<ElevatorDisplay> elevatorDisplay;
+            if (moveMode == MoveMode::DirectArrival && displayPeriod > 0) {
+                elevatorDisplay = addComponent<Profiled<ElevatorDisplay>>("elevatorDisplay", displayPeriod);
+            }
 
             // Connect any non-input/output models with coupling
             //Number input received in elevatorNum is given to elevatorDoor
@@ -73,25 +126,53 @@ namespace cadmium::elevatorSystem {
             addCoupling(elevatorDoor->outFloorToMove,elevatorMove->inMoveFloor);
             //elevatorMove sends floor number elevator is currently on to elevatorDoor
             addCoupling(elevatorMove->outMoveFloor,elevatorDoor->inElevatorMove);
+            //elevatorMove sends the trips it starts to elevatorDisplay
+            if (elevatorDisplay) {
+                addCoupling(elevatorMove->outTrip,elevatorDisplay->inTrip);
+            }
+
+        #ifdef ONLINE_METRICS
+            // Measures the wait from a floor request to the door opening (closed-door light off)
+            auto waitObserver = addComponent<shared::IntervalObserver<int, bool>>("waitObserver", &elevatorWait, false);
+            addCoupling(elevatorNum->out,waitObserver->inStart);
+            addCoupling(elevatorDoor->outDoorStatus,waitObserver->inStop);
+        #endif
+
+        #ifdef LATENCY_PROBES
+            // Takes requestToBuzzer from the button being pressed to the buzzer receiving its duty cycle
+            auto requestProbe = addComponent<shared::LatencyProbe<bool>>("requestProbe", &requestToBuzzer, shared::LatencyEnd::Start, false);
+            auto buzzerProbe = addComponent<shared::LatencyProbe<int>>("buzzerProbe", &requestToBuzzer, shared::LatencyEnd::Stop, buzzerOnDuty);
+            addCoupling(elevatorMove->outMoveBuzzer, buzzerProbe->in);
+        #endif
 
         #ifdef EMBED
 
             // Declare and initialize all embedded input/output models
             // Embedded Inputs
+        #if defined BUSY_WAIT || defined LEGACY_POLLING
             auto digitalInput = addComponent<DigitalInput>("digitalInput",GPIO_PORT_P5,GPIO_PIN1);
             auto joystickInput = addComponent<JoystickInput>("joystickInput");
             auto submitInput = addComponent<DigitalInput>("submitInput", GPIO_PORT_P3,GPIO_PIN5);
+        #else
+            // Woken by GPIO edges and ADC14 window interrupts instead of polling
+            auto digitalInput = addComponent<DigitalInterruptInput>("digitalInput",GPIO_PORT_P5,GPIO_PIN1);
+            auto joystickInput = addComponent<JoystickInterruptInput>("joystickInput");
+            auto submitInput = addComponent<DigitalInterruptInput>("submitInput", GPIO_PORT_P3,GPIO_PIN5);
+        #endif
 
             // Embedded Outputs
             auto digitalOutput = addComponent<DigitalOutput>("digitalOutput",GPIO_PORT_P2,GPIO_PIN2);
 
-            auto lcdOutputStatus = addComponent<LCDOutput>("lcdOutputStatus");
+            auto lcdOutputStatus = addComponent<LCDCommandOutput>("lcdOutputStatus");
 
             auto buzzerOutput = addComponent<PWMOutput>("buzzerOutput", GPIO_PORT_P2, GPIO_PIN7);
 
             // Connect IO models with coupling to the system
             // Embedded Inputs
             addCoupling(digitalInput->out,elevatorNum->inInput);
+        #ifdef LATENCY_PROBES
+            addCoupling(digitalInput->out,requestProbe->in);
+        #endif
 
             addCoupling(joystickInput->outX,elevatorNum->inX);
             addCoupling(joystickInput->outY,elevatorNum->inY);
@@ -102,19 +183,51 @@ namespace cadmium::elevatorSystem {
             //elevatorNum LCD output displayed on MSP LCD screen
             //addCoupling(elevatorNum->lcdStatus, lcdOutputStatus->in);
             addCoupling(elevatorMove->lcdStatus, lcdOutputStatus->in);
+            if (elevatorDisplay) {
+                addCoupling(elevatorDisplay->lcdStatus, lcdOutputStatus->in);
+            }
             //Buzzer turns on when elevator is moving a floor
             addCoupling(elevatorMove->outMoveBuzzer, buzzerOutput->in);
 
+        #if defined LATENCY_PROBES || defined PROFILE_TRANSITIONS || defined ONLINE_METRICS
+            // Prints the latency histograms, the profile of the models and the metrics over the UART
+            addComponent<shared::ProbeReporter>("probeReporter");
+        #endif
+
+
+        #elif defined MERGED_INPUT
+
+            // A single trace holds all the inputs, merged from the text files by "make merged-input".
+            // Inputs with the same timestamp are sent together and handled in one external transition.
+            auto traceInput = addComponent<shared::TraceInput>("traceInput",(inputFolder + "/inputTrace.txt").c_str());
+
+            // Connect each channel of the trace to the rest of the simulation with coupling
+            addCoupling(traceInput->outButton,elevatorNum->inInput);
+        #ifdef LATENCY_PROBES
+            addCoupling(traceInput->outButton,requestProbe->in);
+        #endif
+            addCoupling(traceInput->outX,elevatorNum->inX);
+            addCoupling(traceInput->outY,elevatorNum->inY);
 
         #else
 
+            #ifdef BINARY_INPUT
+            // Declare and initialize all simulated input files, converted from the text files by "make binary-input"
+            auto buttonInput = addComponent<shared::BinaryInputStream<bool>>("buttonInput",(inputFolder + "/buttonInput.bin").c_str());
+            auto joyStickXInput = addComponent<shared::BinaryInputStream<int>>("joyStickXInput",(inputFolder + "/joyStickXInput.bin").c_str());
+            auto joyStickYInput = addComponent<shared::BinaryInputStream<int>>("joyStickYInput",(inputFolder + "/joyStickYInput.bin").c_str());
+            #else
             // Declare and initialize all simulated input files (these must exist in the file system before compilation)
-            auto buttonInput = addComponent<cadmium::lib::IEStream<bool>>("buttonInput",std::move("buttonInput.txt"));
-            auto joyStickXInput = addComponent<cadmium::lib::IEStream<int>>("joyStickXInput",std::move("joyStickXInput.txt"));
-            auto joyStickYInput = addComponent<cadmium::lib::IEStream<int>>("joyStickYInput",std::move("joyStickYInput.txt"));
+            auto buttonInput = addComponent<cadmium::lib::IEStream<bool>>("buttonInput",(inputFolder + "/buttonInput.txt").c_str());
+            auto joyStickXInput = addComponent<cadmium::lib::IEStream<int>>("joyStickXInput",(inputFolder + "/joyStickXInput.txt").c_str());
+            auto joyStickYInput = addComponent<cadmium::lib::IEStream<int>>("joyStickYInput",(inputFolder + "/joyStickYInput.txt").c_str());
+            #endif
 
             // Connect the input files to the rest of the simulation with coupling
             addCoupling(buttonInput->out,elevatorNum->inInput);
+        #ifdef LATENCY_PROBES
+            addCoupling(buttonInput->out,requestProbe->in);
+        #endif
             addCoupling(joyStickXInput->out,elevatorNum->inX);
             addCoupling(joyStickYInput->out,elevatorNum->inY);
 
@@ -0,0 +1,118 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Pending stops of one elevator car, used by the elevatorCar model of buildingSystem.
+ *
+ * The stops are kept in an ordered set, so adding a stop is O(log N) in the number
+ * of floors, and the next stop in the direction of travel is found with one search
+ * instead of checking every floor on the way. The car keeps going in its current
+ * direction while there are stops ahead of it, and only then turns around
+ * (the usual LOOK elevator policy).
+ */
+
+#ifndef __FLOOR_REQUESTS_HPP__
+#define __FLOOR_REQUESTS_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <set>
+
+namespace cadmium::elevatorSystem {
+
+    enum class Direction : int8_t {
+        Down = -1,
+        Idle = 0,
+        Up = 1
+    };
+
+    /**
+     * Returns the direction to take to go from one floor to another.
+     *
+     * @param from floor the car is on.
+     * @param to floor the car goes to.
+     * @return Up, Down, or Idle if both floors are the same.
+     */
+    inline Direction directionTo(int from, int to) {
+        return to > from ? Direction::Up : (to < from ? Direction::Down : Direction::Idle);
+    }
+
+    class FloorRequests {
+        std::set<int> stops;
+
+     public:
+        /**
+         * Adds a stop, doing nothing if the floor is already requested.
+         *
+         * @param floor floor to stop at.
+         */
+        void add(int floor) {
+            stops.insert(floor);
+        }
+
+        /**
+         * Removes a stop once the car has served it.
+         *
+         * @param floor floor the car stopped at.
+         */
+        void remove(int floor) {
+            stops.erase(floor);
+        }
+
+        [[nodiscard]] bool contains(int floor) const {
+            return stops.count(floor) != 0;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return stops.empty();
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return stops.size();
+        }
+
+        /**
+         * Returns the stop to serve next, following the LOOK policy.
+         *
+         * @param floor floor the car is on.
+         * @param direction direction the car was going in (Idle if it was not moving).
+         * @return the nearest stop ahead of the car, the nearest one behind it if there is
+         *         none ahead, or floor itself if nothing is requested.
+         */
+        [[nodiscard]] int next(int floor, Direction direction) const {
+            if (stops.empty()) {
+                return floor;
+            }
+            if (stops.count(floor) != 0) {
+                return floor;
+            }
+            const auto above = stops.upper_bound(floor);
+            const bool hasAbove = above != stops.end();
+            const bool hasBelow = above != stops.begin();
+            if (direction == Direction::Up && hasAbove) {
+                return *above;
+            }
+            if (direction == Direction::Down && hasBelow) {
+                return *std::prev(above);
+            }
+            if (!hasBelow) {
+                return *above;
+            }
+            if (!hasAbove) {
+                return *std::prev(above);
+            }
+            // Idle with stops on both sides: go to the closest one, up on a tie
+            const int up = *above;
+            const int down = *std::prev(above);
+            return up - floor <= floor - down ? up : down;
+        }
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive(stops);
+        }
+    };
+} // namespace cadmium::elevatorSystem
+
+#endif // __FLOOR_REQUESTS_HPP__
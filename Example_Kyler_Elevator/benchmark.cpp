@@ -0,0 +1,12 @@
+// Benchmark of elevatorSystem: see ../Simulation/benchmark.hpp for what is measured
+// Usage: ./elevatorKylerBench [horizon in simulated seconds] [results.json]
+
+#include "../Simulation/benchmark.hpp"
+
+#include <elevatorSystem.hpp>
+
+using namespace cadmium::elevatorSystem;
+
+int main(int argc, char* argv[]) {
+    return cadmium::runBenchmark<elevatorSystem>("elevatorSystem", argc, argv);
+}
@@ -0,0 +1,79 @@
+// Simulation of buildingSystem: N floors served by M elevator cars, see DEVS_Models/buildingSystem.hpp
+// Usage: ./elevatorKylerBuilding [--floors 40] [--cars 8] [--travel 2] [--door 3]
+//                               [--inputs .] [--horizon 3600] [--threads 0] [--min-parallel 16]
+// The log is written to buildingLog.csv (or buildingLog.bin with BINARY_LOGGING).
+// With --threads, the steps of at least --min-parallel imminent models run on that
+// many threads (0 for one per hardware thread, see Simulation/parallelRootCoordinator.hpp);
+// the log holds the same lines as without it, those of a same time in the order of
+// the model ids. The requests of the example inputs reach the dispatcher one at a
+// time, so their steps hold one or two models whatever the number of cars: only
+// --min-parallel 2, or inputs moving many cars at once, use the threads.
+
+#include <simulation/root_coordinator.hpp>
+#include "../Simulation/commandLine.hpp"
+#include "../Simulation/parallelRootCoordinator.hpp"
+#if defined NO_LOGGING
+#elif defined BINARY_LOGGING
+    #include "../Simulation/binaryLogger.hpp"
+#else
+    #include <simulation/logger/csv.hpp>
+#endif
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <buildingSystem.hpp>
+
+using namespace cadmium::elevatorSystem;
+
+template<typename Coordinator>
+void simulate(Coordinator& rootCoordinator, double horizon) {
+#if defined NO_LOGGING
+#elif defined BINARY_LOGGING
+    rootCoordinator.template setLogger<cadmium::BinaryLogger>("buildingLog.bin", ",");
+#else
+    rootCoordinator.template setLogger<cadmium::CSVLogger>("buildingLog.csv", ",");
+#endif
+    rootCoordinator.start();
+    rootCoordinator.simulate(horizon);
+    rootCoordinator.stop();
+}
+
+int main(int argc, char* argv[]) {
+    int floorCount = 40;
+    int carCount = 8;
+    double floorTravelTime = 2.0;
+    double doorOpenTime = 3.0;
+    std::string inputFolder = ".";
+    double horizon = 3600.0;
+    int threads = -1; // Sequential root coordinator
+    std::size_t minParallelModels = 16;
+
+    if (!cadmium::parseCommandLine(argc, argv, {
+            {"--floors", "40", cadmium::integerOption(floorCount)},
+            {"--cars", "8", cadmium::integerOption(carCount)},
+            {"--travel", "2", cadmium::numberOption(floorTravelTime)},
+            {"--door", "3", cadmium::numberOption(doorOpenTime)},
+            {"--inputs", ".", cadmium::textOption(inputFolder)},
+            {"--horizon", "3600", cadmium::numberOption(horizon)},
+            {"--threads", "0", cadmium::integerOption(threads)},
+            {"--min-parallel", "16", cadmium::integerOption(minParallelModels)}})) {
+        return 1;
+    }
+    if (floorCount < 1 || carCount < 1 || floorTravelTime <= 0 || doorOpenTime < 0) {
+        std::cerr << "The building needs at least one floor and one car, a positive travel time and a door time of at least 0" << std::endl;
+        return 1;
+    }
+
+    auto model = std::make_shared<buildingSystem>("buildingSystem", floorCount, carCount, floorTravelTime, doorOpenTime, inputFolder);
+    if (threads < 0) {
+        auto rootCoordinator = cadmium::RootCoordinator(model);
+        simulate(rootCoordinator, horizon);
+    } else {
+        cadmium::ParallelRootCoordinator rootCoordinator(model, static_cast<unsigned>(threads), 0, minParallelModels);
+        simulate(rootCoordinator, horizon);
+    }
+    return 0;
+}
@@ -0,0 +1,25 @@
+// Checkpoints of elevatorSystem, or of buildingSystem with --building: see ../Simulation/checkpointRun.hpp
+// Usage: ./elevatorKylerCheckpoint [--building] [--resume checkpoint] [--until time] [--save checkpoint] [--log file.csv]
+// Built with BINARY_INPUT by "make checkpoint", so the inputs are read from the converted .bin files
+// (or with MERGED_INPUT, reading inputTrace.txt).
+
+#include "../Simulation/checkpointRun.hpp"
+#include "../Shared_Models/binaryInputStream.hpp"
+#include "../Shared_Models/traceInput.hpp"
+
+#include <string>
+
+#include <elevatorSystem.hpp>
+#include <buildingSystem.hpp>
+
+using namespace cadmium::elevatorSystem;
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--building") {
+        argv[1] = argv[0]; // Program name of the remaining options
+        return cadmium::runCheckpoint<buildingSystem, ElevatorCarState, ElevatorDispatcherState,
+                                      cadmium::shared::BinaryInputStreamState>("buildingSystem", argc - 1, argv + 1);
+    }
+    return cadmium::runCheckpoint<elevatorSystem, ElevatorNumState, ElevatorDoorState, ElevatorMoveState, ElevatorDisplayState,
+                                  cadmium::shared::BinaryInputStreamState, cadmium::shared::TraceInputState>("elevatorSystem", argc, argv);
+}
@@ -0,0 +1,74 @@
+// Parameter sweep of elevatorSystem: see ../Simulation/sweep.hpp
+// Usage: ./elevatorKylerSweep [--travel 1,2,3] [--modes per-floor,direct] [--display 0]
+//                            [--inputs .,traces/a] [--horizon 1000] [--threads 0] [--output elevatorSweep.csv]
+// Every combination of the listed values is simulated once.
+
+#include "../Simulation/commandLine.hpp"
+#include "../Simulation/sweep.hpp"
+
+#include <fstream>
+#include <iostream>
+
+#include <elevatorSystem.hpp>
+
+using namespace cadmium::elevatorSystem;
+
+int main(int argc, char* argv[]) {
+    std::vector<double> travelTimes = {2.0};
+    std::vector<std::string> moveModes = {"per-floor"};
+    double displayPeriod = 0;
+    std::vector<std::string> inputFolders = {"."};
+    double horizon = 1000.0;
+    unsigned threads = 0;
+    std::string outputPath = "elevatorSweep.csv";
+
+    if (!cadmium::parseCommandLine(argc, argv, {
+            {"--travel", "1,2,3", [&travelTimes](const std::string& value) { travelTimes = cadmium::parseNumberList(value); }},
+            {"--modes", "per-floor,direct", [&moveModes](const std::string& value) { moveModes = cadmium::splitList(value); }},
+            {"--display", "0", cadmium::numberOption(displayPeriod)},
+            {"--inputs", ".,traces/a", [&inputFolders](const std::string& value) { inputFolders = cadmium::splitList(value); }},
+            {"--horizon", "1000", cadmium::numberOption(horizon)},
+            {"--threads", "0", cadmium::integerOption(threads)},
+            {"--output", "elevatorSweep.csv", cadmium::textOption(outputPath)}})) {
+        return 1;
+    }
+
+    for (const auto& moveMode : moveModes) {
+        if (moveMode != "per-floor" && moveMode != "direct") {
+            std::cerr << "Unknown move mode " << moveMode << " (per-floor or direct)" << std::endl;
+            return 1;
+        }
+    }
+
+    struct Variant {
+        double floorTravelTime;
+        MoveMode moveMode;
+        std::string inputFolder;
+    };
+    std::vector<Variant> variants;
+    std::vector<std::string> parameters;
+    for (const auto& inputFolder : inputFolders) {
+        for (const auto& moveMode : moveModes) {
+            for (const double travel : travelTimes) {
+                variants.push_back({travel, moveMode == "direct" ? MoveMode::DirectArrival : MoveMode::PerFloor, inputFolder});
+                parameters.push_back(cadmium::numberText(travel) + "," + moveMode + "," + cadmium::csvString(inputFolder));
+            }
+        }
+    }
+
+    std::ofstream out(outputPath);
+    if (!out) {
+        std::cerr << "sweep: cannot create " << outputPath << std::endl;
+        return 1;
+    }
+
+    const auto results = cadmium::runSweep(variants.size(), [&variants, displayPeriod](std::size_t i) {
+        const Variant& variant = variants[i];
+        return std::make_shared<elevatorSystem>("elevatorSystem", variant.floorTravelTime, variant.inputFolder,
+                                                variant.moveMode, displayPeriod);
+    }, horizon, threads);
+
+    cadmium::writeSweepCsv(out, "floorTravelTime,moveMode,inputs", parameters, results);
+    std::cout << results.size() << " runs written to " << outputPath << std::endl;
+    return 0;
+}
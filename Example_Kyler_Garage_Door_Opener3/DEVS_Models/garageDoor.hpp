@@ -19,12 +19,21 @@
 // This is an atomic model, meaning it has its' own internal logic/computation
 // So, it is necessary to include atomic.hpp
 #include <modeling/devs/atomic.hpp>
+#include "../../Shared_Models/passivation.hpp"
+#include "../../Shared_Models/lastEmitted.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
 
 #if !defined NO_LOGGING || !defined EMBED
     #include <iostream>
 #endif
 
 namespace cadmium::garageSystem {
+
+    // Default configuration of GarageDoor, folded into the model at compile time
+    struct GarageDoorConfig {
+        static constexpr double pollPeriod = 0.1; // Delay before a change of the LED is sent out
+    };
+
     // A class to represent the state of this specific model
     // All atomic models will have their own state
     struct GarageDoorState {
@@ -34,9 +43,16 @@ namespace cadmium::garageSystem {
 
         // Declare model-specific variables
         bool lightOn;
+        shared::LastEmitted<bool> lastLightOn; //Last LED status sent, used to skip repeated messages
 
         // Set the default values for the state constructor for this specific model
         GarageDoorState(): sigma(0), lightOn(false)  {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(lightOn, lastLightOn);
+        }
     };
 #if !defined NO_LOGGING || !defined EMBED
     /**
@@ -58,8 +74,9 @@ namespace cadmium::garageSystem {
     }
 #endif
 
-    // Atomic DEVS model of GarageDoor.
-    class GarageDoor : public Atomic<GarageDoorState> {
+    // Atomic DEVS model of GarageDoor, see GarageDoorConfig for its configuration
+    template<typename Config = GarageDoorConfig>
+    class GarageDoorModel : public Atomic<GarageDoorState> {
      private:
 
      public:
@@ -67,13 +84,13 @@ namespace cadmium::garageSystem {
         // Declare ports for the model
 
         // Input ports
-        Port<bool> in;
+        shared::BoundedPort<bool, 1> in;
 
         // Output ports
-        Port<bool> outLED;
+        shared::BoundedPort<bool, 1> outLED;
 
         // Declare variables for the model's behaviour
-        // (NOT APPLICABLE TO THIS MODEL)
+        static constexpr double pollPeriod = Config::pollPeriod; // Delay before a change of the LED is sent out
 
 
         /**
@@ -84,7 +101,7 @@ namespace cadmium::garageSystem {
          *
          * @param id ID of the new GarageDoor model object.
          */
-        GarageDoor(const std::string& id): Atomic<GarageDoorState>(id, GarageDoorState()) {
+        explicit GarageDoorModel(const std::string& id): Atomic<GarageDoorState>(id, GarageDoorState()) {
 
             // Initialize ports for the model
 
@@ -96,13 +113,9 @@ namespace cadmium::garageSystem {
 
             //lcdToggle = addOutPort<std::string>("lcdToggle");
 
-            // Initialize variables for the model's behvaiour
-            // (NOT APPLICABLE TO THIS MODEL)
-
-
-            // Set a value for sigma (so it is not 0), this determines how often the
-            // internal transition occurs
-            state.sigma = 0.1;
+            // Set a value for sigma (so it is not 0), this determines when the
+            // first internal transition occurs
+            state.sigma = pollPeriod;
 
         }
 
@@ -110,12 +123,15 @@ namespace cadmium::garageSystem {
          * The transition function is invoked each time the value of
          * state.sigma reaches 0.
          *
-         * In this model, the transition function does nothing.
+         * In this model, the LED status has just been sent, so the model goes
+         * passive until the next authorization (or keeps polling when
+         * LEGACY_POLLING is defined).
          *
          * @param state reference to the current state of the model.
          */
         void internalTransition(GarageDoorState& state) const override {
-
+            state.lastLightOn.record(state.lightOn);
+            state.sigma = shared::idleSigma(pollPeriod);
         }
 
         /**
@@ -138,6 +154,7 @@ namespace cadmium::garageSystem {
                 for( const auto x : in->getBag()){
                     if (x==true){
                         state.lightOn = !state.lightOn; // if authorized, we update the state of our model to turn on the LED
+                        state.sigma = pollPeriod;
                     }
                 }
             }
@@ -154,7 +171,7 @@ namespace cadmium::garageSystem {
          */
         void output(const GarageDoorState& state) const override {
 
-            outLED->addMessage(state.lightOn);
+            shared::emitIfChanged(outLED, state.lastLightOn, state.lightOn);
 
         }
 
@@ -170,6 +187,8 @@ namespace cadmium::garageSystem {
             return state.sigma;
         }
     };
+
+    using GarageDoor = GarageDoorModel<>;
 } // namespace cadmium::GarageDoorSystem
 
 #endif // __GARAGE_DOOR_HPP__
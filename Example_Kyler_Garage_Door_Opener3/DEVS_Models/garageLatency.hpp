@@ -0,0 +1,22 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Response time probes of the GarageDoorOpener example, compiled only with LATENCY_PROBES
+ * (see Simulation/latency.hpp).
+ *
+ * submitToLed runs from the submit button being pressed, when the input model emits
+ * it, to the LED receiving its new status once the password was accepted. It is
+ * taken by the LatencyProbe models of garageSystem (see Shared_Models/latencyProbes.hpp).
+ */
+
+#ifndef __GARAGE_LATENCY_HPP__
+#define __GARAGE_LATENCY_HPP__
+
+#include "../../Simulation/latency.hpp"
+
+namespace cadmium::garageSystem {
+    LATENCY_SPAN(submitToLed);
+} // namespace cadmium::garageSystem
+
+#endif // __GARAGE_LATENCY_HPP__
@@ -32,12 +32,68 @@
 // This is an atomic model, meaning it has its' own internal logic/computation
 // So, it is necessary to include atomic.hpp
 #include <modeling/devs/atomic.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "../../Shared_Models/passivation.hpp"
+#include "../../Shared_Models/lastEmitted.hpp"
+#include "../../Shared_Models/lcdCommand.hpp"
+#include "../../Shared_Models/quadrantDecoder.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
+#include "garageMetrics.hpp"
 
 #if !defined NO_LOGGING || !defined EMBED
     #include <iostream>
 #endif
 
 namespace cadmium::garageSystem {
+
+    // Digits entered since the last submit, kept in place instead of in a std::string
+    struct PasswordEntry {
+        static constexpr std::size_t CAPACITY = 8; // Longest password that can be checked
+
+        char digits[CAPACITY + 1]; // First CAPACITY digits entered, NUL-terminated
+        uint8_t length;            // Digits entered, even past CAPACITY (up to 255)
+
+        PasswordEntry(): digits(), length(0) {}
+
+        void append(char digit) {
+            if (length < CAPACITY) {
+                digits[length] = digit;
+                digits[length + 1] = '\0';
+            }
+            length = length < UINT8_MAX ? length + 1 : length;
+        }
+
+        void clear() {
+            digits[0] = '\0';
+            length = 0;
+        }
+
+        /**
+         * Compares the digits entered with a password known at compile time,
+         * which is a compare of a fixed number of bytes.
+         *
+         * @param password expected password.
+         * @return true if exactly the digits of the password were entered.
+         */
+        template<std::size_t N>
+        [[nodiscard]] bool matches(const char (&password)[N]) const {
+            static_assert(N - 1 <= CAPACITY, "The password is longer than PasswordEntry::CAPACITY");
+            return length == N - 1 && std::char_traits<char>::compare(digits, password, N - 1) == 0;
+        }
+    };
+
+    // Default configuration of GarageLock, folded into the model at compile time.
+    // Another lock derives from it and hides the members it changes, e.g.
+    //     struct BackDoorLock : GarageLockConfig { static constexpr char password[] = "4321"; };
+    //     addComponent<GarageLockModel<BackDoorLock>>("backDoorLock");
+    struct GarageLockConfig {
+        static constexpr char password[] = "1234";         // Digits 1 to 4, see the diagram above
+        static constexpr double pollPeriod = 0.1;          // Delay before a change of the lock status is sent out
+        using AxisZones = shared::JoystickAxisZones;       // Joystick zones selecting the digits
+    };
+
     // A class to represent the state of this specific model
     // All atomic models will have their own state
     struct GarageLockState {
@@ -46,18 +102,29 @@ namespace cadmium::garageSystem {
         double sigma;
 
         // Declare model-specific variables
-        double temperatureFound;
+        uint8_t temperatureLevel; // Level of the temperature from the conditioner: 0 while frozen, 1 above 25 *C
         bool authorized;
-        std::string password;
+        PasswordEntry password;
         int xCoordinate;
         int yCoordinate;
 
-        std::string currentStatus; //String used to display current info on the garage door and PW attempt
-        std::string frozenStatus; //New String used to display status of garage door being frozen or not
+        shared::LcdCommand currentStatus; //LCD command used to display current info on the garage door and PW attempt
+        shared::LcdCommand frozenStatus; //LCD command used to display status of garage door being frozen or not
         int inputNumber; //Number used to display inputs on the lcd screen
 
+        //Last values sent on the LCD ports, used to skip repeated messages
+        shared::LastEmitted<shared::LcdCommand> lastStatus;
+        shared::LastEmitted<shared::LcdCommand> lastFrozenStatus;
+
         // Set the default values for the state constructor for this specific model
-        GarageLockState(): sigma(0), temperatureFound(0), authorized(false), password(""), xCoordinate(0), yCoordinate(0), inputNumber(0)  {}
+        GarageLockState(): sigma(0), temperatureLevel(0), authorized(false), password(), xCoordinate(0), yCoordinate(0), inputNumber(0)  {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(temperatureLevel, authorized, password, xCoordinate, yCoordinate);
+            archive(currentStatus, frozenStatus, inputNumber, lastStatus, lastFrozenStatus);
+        }
     };
 
 #if !defined NO_LOGGING || !defined EMBED
@@ -74,32 +141,45 @@ namespace cadmium::garageSystem {
      * @return output stream with password, authorized, x and y coordinates already inserted.
      */
     std::ostream& operator<<(std::ostream &out, const GarageLockState& state) {
-        out << ",PasswordEntered: " << state.password << ",Authorized: " << state.authorized
+        out << ",PasswordEntered: " << state.password.digits << ",Authorized: " << state.authorized
             << ",xCoordinate: " << state.xCoordinate << ",yCoordinate: " << state.yCoordinate;
         return out;
     }
 #endif
 
-    // Atomic DEVS model of GarageLock
-    class GarageLock : public Atomic<GarageLockState> {
+    // Atomic DEVS model of GarageLock, see GarageLockConfig for its configuration
+    template<typename Config = GarageLockConfig>
+    class GarageLockModel : public Atomic<GarageLockState> {
      private:
 
+        // Password digit entered at each joystick position, following the diagram above (0: no digit)
+        static constexpr shared::QuadrantDecoder<typename Config::AxisZones, typename Config::AxisZones> passwordDigits{{
+            {3, 0, 4},  // Y low
+            {0, 0, 0},  // Y centre
+            {2, 0, 1}   // Y high
+        }};
+
+        static_assert(passwordDigits.decode(1023, 1023) == 1 && passwordDigits.decode(0, 1023) == 2
+                      && passwordDigits.decode(0, 0) == 3 && passwordDigits.decode(1023, 0) == 4
+                      && passwordDigits.decode(500, 1023) == 0, "passwordDigits must follow the diagram");
+
      public:
 
         // Declare ports for the model
         // Input ports
-        Port<int> inX;
-        Port<int> inY;
-        Port<bool> inInput;
-        Port<bool> inSubmit;
-        Port<double> acquiredTemperature;
+        shared::BoundedPort<int, 1> inX;
+        shared::BoundedPort<int, 1> inY;
+        shared::BoundedPort<bool, 1> inInput;
+        shared::BoundedPort<bool, 1> inSubmit;
+        shared::BoundedPort<uint8_t, 1> inTemperatureLevel;
 
         // Output ports
-        Port<bool> out;
-        Port<std::string> lcdStatus;
-        Port<std::string> lcdFrozenStatus;
+        shared::BoundedPort<bool, 1> out;
+        shared::BoundedPort<shared::LcdCommand, 5> lcdStatus; // The 4 rows queued by the constructor, then one per output
+        shared::BoundedPort<shared::LcdCommand, 2> lcdFrozenStatus; // The row queued by the constructor, then one per output
 
-        // (NOT APPLICABLE FOR THIS MODEL) Declare variables for the model's behaviour
+        // Declare variables for the model's behaviour
+        static constexpr double pollPeriod = Config::pollPeriod; // Delay before a change of the lock status is sent out
 
         /**
          * Constructor function for this atomic model, and its respective state object.
@@ -109,7 +189,7 @@ namespace cadmium::garageSystem {
          *
          * @param id ID of the new GarageLock model object.
          */
-        GarageLock(const std::string& id): Atomic<GarageLockState>(id, GarageLockState()) {
+        explicit GarageLockModel(const std::string& id): Atomic<GarageLockState>(id, GarageLockState()) {
 
             // Initialize ports for the model
 
@@ -118,30 +198,29 @@ namespace cadmium::garageSystem {
             inY = addInPort<int>("inY");
             inInput  = addInPort<bool>("inInput");
             inSubmit = addInPort<bool>("inSubmit");
-            acquiredTemperature = addInPort<double>("acquiredTemperature");
+            inTemperatureLevel = addInPort<uint8_t>("inTemperatureLevel");
 
             // Output ports
             out = addOutPort<bool>("out");
 
             //lcdStatus = addOutPort<std::string>("lcdStatus");
-            lcdStatus = addOutPort<std::string>("lcdToggle");
-            lcdFrozenStatus = addOutPort<std::string>("lcdFrozen");
+            lcdStatus = addOutPort<shared::LcdCommand>("lcdToggle");
+            lcdFrozenStatus = addOutPort<shared::LcdCommand>("lcdFrozen");
 
-            // Set a value for sigma (so it is not 0), this determines how often the
-            // internal transition occurs
-            state.sigma = 0.1;
+            // Set a value for sigma (so it is not 0), this determines when the
+            // first internal transition occurs
+            state.sigma = pollPeriod;
 
             //Initial string display on lcd screen
-            state.currentStatus = "BSP_LCD_DrawString(0,0,Garage Door Opener 3,LCD_WHITE)";
-            lcdStatus->addMessage(state.currentStatus);
-            state.currentStatus = "BSP_LCD_DrawString(0,1,TLeft=2 TRight=1,LCD_WHITE)";
+            lcdStatus->addMessage(shared::LcdCommand(0, 0, "Garage Door Opener 3"));
+            lcdStatus->addMessage(shared::LcdCommand(0, 1, "TLeft=2 TRight=1"));
+            lcdStatus->addMessage(shared::LcdCommand(0, 2, "BLeft=3 BRight=4"));
+            state.currentStatus = shared::LcdCommand(0, 3, "TopInput BottomSubmit");
             lcdStatus->addMessage(state.currentStatus);
-            state.currentStatus = "BSP_LCD_DrawString(0,2,BLeft=3 BRight=4,LCD_WHITE)";
-            lcdStatus->addMessage(state.currentStatus);
-            state.currentStatus = "BSP_LCD_DrawString(0,3,TopInput BottomSubmit,LCD_WHITE)";
-            lcdStatus->addMessage(state.currentStatus);
-            state.frozenStatus = "BSP_LCD_DrawString(0,7,.,LCD_WHITE)";
+            state.lastStatus.record(state.currentStatus);
+            state.frozenStatus = shared::LcdCommand(0, 7, ".");
             lcdFrozenStatus->addMessage(state.frozenStatus);
+            state.lastFrozenStatus.record(state.frozenStatus);
         }
 
         /**
@@ -149,14 +228,19 @@ namespace cadmium::garageSystem {
          * state.sigma reaches 0.
          *
          * In this model, it updates the GarageLock state authorized
-         * to false if it is true.
+         * to false if it is true. The model then goes passive until the next
+         * input that changes its outputs (or keeps polling when LEGACY_POLLING
+         * is defined).
          *
          * @param state reference to the current state of the model.
          */
         void internalTransition(GarageLockState& state) const override {
+            state.lastStatus.record(state.currentStatus);
+            state.lastFrozenStatus.record(state.frozenStatus);
             if (state.authorized == true) {
                 state.authorized = false;
             }
+            state.sigma = shared::idleSigma(pollPeriod);
         }
 
         /**
@@ -172,6 +256,11 @@ namespace cadmium::garageSystem {
          */
         void externalTransition(GarageLockState& state, double e) const override {
 
+            const bool previousAuthorized = state.authorized;
+            const int previousInputNumber = state.inputNumber;
+            const shared::LcdCommand previousFrozenStatus = state.frozenStatus;
+            bool submitted = false;
+
             // First check if there are un-handled inputs for the "in" port
             if(!inInput->empty()){
 
@@ -184,23 +273,12 @@ namespace cadmium::garageSystem {
                         // If the button (associated with the in port) was pressed, then the
                         // x and y coordinates determine the entered password digit
 
-                        if ((state.xCoordinate > 600)&&(state.yCoordinate > 600)){
-                            state.password.append("1");
-                            state.currentStatus = "BSP_LCD_DrawString(" + std::to_string(state.inputNumber) + ",4,1,LCD_WHITE)";
-                            state.inputNumber++;
-                        } else if ((state.xCoordinate < 400)&&(state.yCoordinate > 600)){
-                            state.password.append("2");
-                            state.currentStatus = "BSP_LCD_DrawString(" + std::to_string(state.inputNumber) + ",4,2,LCD_WHITE)";
+                        const uint8_t digit = passwordDigits.decode(state.xCoordinate, state.yCoordinate);
+                        if (digit != 0){
+                            const char digitText[2] = {static_cast<char>('0' + digit), '\0'};
+                            state.password.append(digitText[0]);
+                            state.currentStatus = shared::LcdCommand(state.inputNumber, 4, digitText);
                             state.inputNumber++;
-                        } else if ((state.xCoordinate < 400)&&(state.yCoordinate < 400)){
-                            state.password.append("3");
-                            state.currentStatus = "BSP_LCD_DrawString(" + std::to_string(state.inputNumber) + ",4,3,LCD_WHITE)";
-                            state.inputNumber++;
-                        } else if ((state.xCoordinate > 600)&&(state.yCoordinate < 400)){
-                            state.password.append("4");
-                            state.currentStatus = "BSP_LCD_DrawString(" + std::to_string(state.inputNumber) + ",4,4,LCD_WHITE)";
-                            state.inputNumber++;
-
                         }
                     }
                 }
@@ -210,13 +288,15 @@ namespace cadmium::garageSystem {
             if(!inSubmit->empty()){
                 for( const auto i : inSubmit->getBag()){
                     if (i==0){
-                        std::string currentPassword = "1234";
-                        if (state.password.compare(currentPassword) == 0){
+                        const bool matched = state.password.matches(Config::password);
+                        if (matched){
                             state.authorized = true;
                         }
-                        state.password = "";
-                        state.currentStatus = "BSP_LCD_DrawString(0,4,       ,LCD_WHITE)";
+                        METRIC_HIT(lockAuthorized, matched);
+                        state.password.clear();
+                        state.currentStatus = shared::LcdCommand(0, 4, "       ");
                         state.inputNumber = 0;
+                        submitted = true;
                     }
                 }
             }
@@ -236,20 +316,27 @@ namespace cadmium::garageSystem {
                 }
             }
 
-            if(!acquiredTemperature->empty()) {
-                for(const auto i : acquiredTemperature->getBag()){
-                    state.temperatureFound = i;
-                    if(state.temperatureFound <= 24.0){
-                        state.frozenStatus = "BSP_LCD_DrawString(0,7,FROZEN,LCD_WHITE)";
+            if(!inTemperatureLevel->empty()) {
+                for(const auto level : inTemperatureLevel->getBag()){
+                    state.temperatureLevel = level;
+                    if(state.temperatureLevel == 0){
+                        state.frozenStatus = shared::LcdCommand(0, 7, "FROZEN");
 
                     }
                     else{
-                        state.frozenStatus = "BSP_LCD_DrawString(0,7,WORKING,LCD_WHITE)";
+                        state.frozenStatus = shared::LcdCommand(0, 7, "WORKING");
                     }
 
                 }
             }
 
+            // Only schedule an output when a digit was entered, a password was submitted,
+            // or the frozen status changed. Joystick movement alone is not reported.
+            if(submitted || state.authorized != previousAuthorized || state.inputNumber != previousInputNumber
+               || state.frozenStatus != previousFrozenStatus){
+                state.sigma = pollPeriod;
+            }
+
         }
 
         /**
@@ -262,9 +349,10 @@ namespace cadmium::garageSystem {
          * @param state reference to the current model state.
          */
         void output(const GarageLockState& state) const override {
+            // Every authorization toggles garageDoor, so this port is never filtered
             out->addMessage(state.authorized);
-            lcdStatus->addMessage(state.currentStatus);
-            lcdFrozenStatus->addMessage(state.frozenStatus);
+            shared::emitIfChanged(lcdStatus, state.lastStatus, state.currentStatus);
+            shared::emitIfChanged(lcdFrozenStatus, state.lastFrozenStatus, state.frozenStatus);
 
         }
 
@@ -280,6 +368,8 @@ namespace cadmium::garageSystem {
             return state.sigma;
         }
     };
+
+    using GarageLock = GarageLockModel<>;
 } // namespace cadmium::garageLockSystem
 
 #endif // __GARAGE_LOCK_HPP__
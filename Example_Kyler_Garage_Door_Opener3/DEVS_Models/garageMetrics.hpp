@@ -0,0 +1,25 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Online metrics of the GarageDoorOpener example, compiled only with ONLINE_METRICS
+ * (see Simulation/metrics.hpp).
+ *
+ * lockAuthorized counts the passwords submitted to garageLock, and how many of
+ * them were accepted. garageFrozen and garageWorking are the periods spent with
+ * the temperature level at 0 (FROZEN) and above, measured by the frozenObserver
+ * of garageSystem; garageLock is FROZEN until the conditioner sends a level.
+ */
+
+#ifndef __GARAGE_METRICS_HPP__
+#define __GARAGE_METRICS_HPP__
+
+#include "../../Simulation/metrics.hpp"
+
+namespace cadmium::garageSystem {
+    METRIC_RATIO(lockAuthorized);
+    METRIC_SUMMARY(garageFrozen, "s");
+    METRIC_SUMMARY(garageWorking, "s");
+} // namespace cadmium::garageSystem
+
+#endif // __GARAGE_METRICS_HPP__
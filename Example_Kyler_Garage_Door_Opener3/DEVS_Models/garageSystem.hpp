@@ -42,10 +42,23 @@
     #include "../../IO_Models/digitalOutput.hpp"
     #include "../../IO_Models/joystickInput.hpp"
     #include "../../IO_Models/lcdOutput.hpp"
+    #include "../../IO_Models/lcdCommandOutput.hpp"
     #include "../../IO_Models/lightSensorInput.hpp"
     #include "../../IO_Models/microphoneInput.hpp"
     #include "../../IO_Models/pwmOutput.hpp"
     #include "../../IO_Models/temperatureSensorInput.hpp"
+    // Nothing wakes the interrupt-driven inputs without LowPowerRootCoordinator, so they poll then
+    #if !defined BUSY_WAIT && !defined LEGACY_POLLING
+        #include "../../IO_Models/digitalInterruptInput.hpp"
+        #include "../../IO_Models/adcDmaInput.hpp"
+    #endif
+    #if defined LATENCY_PROBES || defined PROFILE_TRANSITIONS || defined ONLINE_METRICS
+        #include "../../Shared_Models/probeReporter.hpp"
+    #endif
+#elif defined MERGED_INPUT
+    #include "../../Shared_Models/traceInput.hpp"
+#elif defined BINARY_INPUT
+    #include "../../Shared_Models/binaryInputStream.hpp"
 #else
     #include <lib/iestream.hpp>
 #endif
@@ -53,50 +66,100 @@
 // We include any models that are directly contained within this coupled model
 #include "garageLock.hpp"
 #include "garageDoor.hpp"
-#include "temperatureGarage.hpp"
+#include "../../Shared_Models/temperatureConditioner.hpp"
+#include "../../Simulation/transitionProfiler.hpp"
+#include "../../Shared_Models/metricObservers.hpp"
+#include "garageMetrics.hpp"
+#include "../../Shared_Models/latencyProbes.hpp"
+#include "garageLatency.hpp"
 
 namespace cadmium::garageSystem {
     class garageSystem : public Coupled {
         public:
-        garageSystem(const std::string& id): Coupled(id){
+        /**
+         * @param id ID of the system.
+         * @param inputFolder folder holding the simulated input files (simulation only).
+         */
+        explicit garageSystem(const std::string& id, const std::string& inputFolder = "."): Coupled(id){
 
             // Declare and initialize all controller models (non-input/output)
-            auto garageLock = addComponent<GarageLock>("garageLock");
-            auto garageDoor = addComponent<GarageDoor>("garageDoor");
-            auto temperatureGarage = addComponent<TemperatureGarage>("garageTemperature");
+            auto garageLock = addComponent<Profiled<GarageLock>>("garageLock");
+            auto garageDoor = addComponent<Profiled<GarageDoor>>("garageDoor");
+            // Shows changes of 0.1 *C, and FROZEN until 25 *C, then again under 24.5 *C, as the 24 *C whole degrees did
+            shared::TemperatureConditionerConfig temperatureConfig;
+            temperatureConfig.filter = shared::TemperatureFilter::Exponential;
+            temperatureConfig.delta = 10;
+            temperatureConfig.addThreshold(2500, 2450);
+            temperatureConfig.lcdRow = 9;
+            auto temperatureGarage = addComponent<Profiled<shared::TemperatureConditioner>>("garageTemperature", temperatureConfig);
 
             // Connect any non-input/output models with coupling
             addCoupling(garageLock->out,garageDoor->in);
-            addCoupling(temperatureGarage->out, garageLock->acquiredTemperature);
+            addCoupling(temperatureGarage->outLevel, garageLock->inTemperatureLevel);
+
+        #ifdef ONLINE_METRICS
+            // Measures the periods spent FROZEN (temperature level 0) and working; garageLock starts FROZEN
+            auto frozenObserver = addComponent<shared::PhaseObserver<uint8_t, 1>>("frozenObserver",
+                                                                                  std::array<MetricSummary*, 2>{&garageFrozen, &garageWorking}, 0);
+            addCoupling(temperatureGarage->outLevel, frozenObserver->in[0]);
+        #endif
+
+        #ifdef LATENCY_PROBES
+            // Takes submitToLed from the submit button being pressed to the LED receiving its new status
+            auto submitProbe = addComponent<shared::LatencyProbe<bool>>("submitProbe", &submitToLed, shared::LatencyEnd::Start, false);
+            auto ledProbe = addComponent<shared::LatencyProbe<bool>>("ledProbe", &submitToLed, shared::LatencyEnd::Stop);
+            addCoupling(garageDoor->outLED, ledProbe->in);
+        #endif
 
         #ifdef EMBED
 
             // Declare and initialize all embedded input/output models
             // Embedded Inputs
+        #if defined BUSY_WAIT || defined LEGACY_POLLING
             auto digitalInput = addComponent<DigitalInput>("digitalInput",GPIO_PORT_P5,GPIO_PIN1);
-            auto joystickInput = addComponent<JoystickInput>("joystickInput");
             auto submitInput = addComponent<DigitalInput>("submitInput", GPIO_PORT_P3,GPIO_PIN5);
+        #else
+            // Woken by GPIO edges instead of polling
+            auto digitalInput = addComponent<DigitalInterruptInput>("digitalInput",GPIO_PORT_P5,GPIO_PIN1);
+            auto submitInput = addComponent<DigitalInterruptInput>("submitInput", GPIO_PORT_P3,GPIO_PIN5);
+        #endif
+        #if defined BUSY_WAIT || defined LEGACY_POLLING
+            auto joystickInput = addComponent<JoystickInput>("joystickInput");
 
             auto temperatureInput = addComponent<TemperatureSensorInput>("temperatureInput"); //MSP432 Temperature sensor
+        #else
+            // The joystick and the temperature sensor share ADC14: one sequence, sent a block of 16 samples at a time
+            auto adcInput = addComponent<AdcDmaInput>("adcInput");
+        #endif
 
             // Embedded Outputs
             auto digitalOutput = addComponent<DigitalOutput>("digitalOutput",GPIO_PORT_P2,GPIO_PIN2);
 
-            auto lcdOutputStatus = addComponent<LCDOutput>("lcdOutputStatus");
+            auto lcdOutputStatus = addComponent<LCDCommandOutput>("lcdOutputStatus");
 
-            auto lcdOutputTemperature = addComponent<LCDOutput>("lcdOutputTemperature");
+            auto lcdOutputTemperature = addComponent<LCDCommandOutput>("lcdOutputTemperature");
 
-            auto lcdOutputFrozenStatus = addComponent<LCDOutput>("lcdOutputFrozenStatus");
+            auto lcdOutputFrozenStatus = addComponent<LCDCommandOutput>("lcdOutputFrozenStatus");
 
 
             // Connect IO models with coupling to the system
             // Embedded Inputs
             addCoupling(digitalInput->out,garageLock->inInput);
             addCoupling(submitInput->out,garageLock->inSubmit);
+        #ifdef LATENCY_PROBES
+            addCoupling(submitInput->out,submitProbe->in);
+        #endif
+        #if defined BUSY_WAIT || defined LEGACY_POLLING
             addCoupling(temperatureInput->out, temperatureGarage->inTemperature);
 
             addCoupling(joystickInput->outX,garageLock->inX);
             addCoupling(joystickInput->outY,garageLock->inY);
+        #else
+            addCoupling(adcInput->outTemperature, temperatureGarage->inTemperature);
+
+            addCoupling(adcInput->outX,garageLock->inX);
+            addCoupling(adcInput->outY,garageLock->inY);
+        #endif
 
             // Embedded Outputs
             addCoupling(garageDoor->outLED,digitalOutput->in);
@@ -104,17 +167,48 @@ namespace cadmium::garageSystem {
             addCoupling(temperatureGarage->lcdTemperature, lcdOutputTemperature->in);
             addCoupling(garageLock->lcdFrozenStatus, lcdOutputFrozenStatus->in);
 
+        #if defined LATENCY_PROBES || defined PROFILE_TRANSITIONS || defined ONLINE_METRICS
+            // Prints the latency histograms, the profile of the models and the metrics over the UART
+            addComponent<shared::ProbeReporter>("probeReporter");
+        #endif
+
+        #elif defined MERGED_INPUT
+
+            // A single trace holds all the inputs, merged from the text files by "make merged-input".
+            // Inputs with the same timestamp are sent together and handled in one external transition.
+            auto traceInput = addComponent<shared::TraceInput>("traceInput",(inputFolder + "/inputTrace.txt").c_str());
+
+            // Connect each channel of the trace to the rest of the simulation with coupling
+            addCoupling(traceInput->outButton,garageLock->inInput);
+            addCoupling(traceInput->outSubmit,garageLock->inSubmit);
+        #ifdef LATENCY_PROBES
+            addCoupling(traceInput->outSubmit,submitProbe->in);
+        #endif
+            addCoupling(traceInput->outX,garageLock->inX);
+            addCoupling(traceInput->outY,garageLock->inY);
+
         #else
 
+            #ifdef BINARY_INPUT
+            // Declare and initialize all simulated input files, converted from the text files by "make binary-input"
+            auto buttonInput = addComponent<shared::BinaryInputStream<bool>>("buttonInput",(inputFolder + "/buttonInput.bin").c_str());
+            auto buttonSubmit = addComponent<shared::BinaryInputStream<bool>>("buttonSubmit",(inputFolder + "/buttonSubmit.bin").c_str());
+            auto joyStickXInput = addComponent<shared::BinaryInputStream<int>>("joyStickXInput",(inputFolder + "/joyStickXInput.bin").c_str());
+            auto joyStickYInput = addComponent<shared::BinaryInputStream<int>>("joyStickYInput",(inputFolder + "/joyStickYInput.bin").c_str());
+            #else
             // Declare and initialize all simulated input files (these must exist in the file system before compilation)
-            auto buttonInput = addComponent<cadmium::lib::IEStream<bool>>("buttonInput",std::move("buttonInput.txt"));
-            auto buttonSubmit = addComponent<cadmium::lib::IEStream<bool>>("buttonSubmit",std::move("buttonSubmit.txt"));
-            auto joyStickXInput = addComponent<cadmium::lib::IEStream<int>>("joyStickXInput",std::move("joyStickXInput.txt"));
-            auto joyStickYInput = addComponent<cadmium::lib::IEStream<int>>("joyStickYInput",std::move("joyStickYInput.txt"));
+            auto buttonInput = addComponent<cadmium::lib::IEStream<bool>>("buttonInput",(inputFolder + "/buttonInput.txt").c_str());
+            auto buttonSubmit = addComponent<cadmium::lib::IEStream<bool>>("buttonSubmit",(inputFolder + "/buttonSubmit.txt").c_str());
+            auto joyStickXInput = addComponent<cadmium::lib::IEStream<int>>("joyStickXInput",(inputFolder + "/joyStickXInput.txt").c_str());
+            auto joyStickYInput = addComponent<cadmium::lib::IEStream<int>>("joyStickYInput",(inputFolder + "/joyStickYInput.txt").c_str());
+            #endif
 
             // Connect the input files to the rest of the simulation with coupling
             addCoupling(buttonInput->out,garageLock->inInput);
             addCoupling(buttonSubmit->out,garageLock->inSubmit);
+        #ifdef LATENCY_PROBES
+            addCoupling(buttonSubmit->out,submitProbe->in);
+        #endif
             addCoupling(joyStickXInput->out,garageLock->inX);
             addCoupling(joyStickYInput->out,garageLock->inY);
 
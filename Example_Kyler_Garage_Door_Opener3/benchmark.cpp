@@ -0,0 +1,12 @@
+// Benchmark of garageSystem: see ../Simulation/benchmark.hpp for what is measured
+// Usage: ./garageOpenerBench [horizon in simulated seconds] [results.json]
+
+#include "../Simulation/benchmark.hpp"
+
+#include <garageSystem.hpp>
+
+using namespace cadmium::garageSystem;
+
+int main(int argc, char* argv[]) {
+    return cadmium::runBenchmark<garageSystem>("garageSystem", argc, argv);
+}
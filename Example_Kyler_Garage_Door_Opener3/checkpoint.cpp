@@ -0,0 +1,18 @@
+// Checkpoints of garageSystem: see ../Simulation/checkpointRun.hpp
+// Usage: ./garageOpenerCheckpoint [--resume checkpoint] [--until time] [--save checkpoint] [--log file.csv]
+// Built with BINARY_INPUT by "make checkpoint", so the inputs are read from the converted .bin files
+// (or with MERGED_INPUT, reading inputTrace.txt).
+
+#include "../Simulation/checkpointRun.hpp"
+#include "../Shared_Models/binaryInputStream.hpp"
+#include "../Shared_Models/traceInput.hpp"
+#include "../Shared_Models/temperatureConditioner.hpp"
+
+#include <garageSystem.hpp>
+
+using namespace cadmium::garageSystem;
+
+int main(int argc, char* argv[]) {
+    return cadmium::runCheckpoint<garageSystem, GarageLockState, GarageDoorState, cadmium::shared::TemperatureConditionerState,
+                                  cadmium::shared::BinaryInputStreamState, cadmium::shared::TraceInputState>("garageSystem", argc, argv);
+}
@@ -13,12 +13,22 @@
 // This is an atomic model, meaning it has its' own internal logic/computation
 // So, it is necessary to include atomic.hpp
 #include <modeling/devs/atomic.hpp>
+#include <cstdint>
+#include "../../Shared_Models/passivation.hpp"
+#include "../../Shared_Models/lastEmitted.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
 
 #if !defined NO_LOGGING || !defined EMBED
     #include <iostream>
 #endif
 
 namespace cadmium::temperatureSystem {
+
+    // Default configuration of TemperatureSignal, folded into the model at compile time
+    struct TemperatureSignalConfig {
+        static constexpr double pollPeriod = 1.0; // Delay before a change of the LEDs/buzzer is sent out
+        static constexpr int buzzerDuty = 5;      // Duty cycle of the buzzer while the temperature is high
+    };
     // A class to represent the state of this specific model
     // All atomic models will have their own state
     struct TemperatureSignalState {
@@ -27,15 +37,26 @@ namespace cadmium::temperatureSystem {
         double sigma;
 
         // Declare model-specific variables
-        double temperatureFound;
+        uint8_t temperatureLevel; // Level of the temperature from the conditioner: 0 below 26.5 *C, 1 above
 
         bool mspRedOn;
         bool mspBlueOn;
 
         int buzzerDuty;
 
+        //Last values sent on the output ports, used to skip repeated messages
+        shared::LastEmitted<bool> lastRedOn;
+        shared::LastEmitted<bool> lastBlueOn;
+        shared::LastEmitted<int> lastBuzzerDuty;
+
         // Set the default values for the state constructor for this specific model
-        TemperatureSignalState(): sigma(0), temperatureFound(0) , mspRedOn(false), mspBlueOn(false), buzzerDuty(0) {}
+        TemperatureSignalState(): sigma(0), temperatureLevel(0) , mspRedOn(false), mspBlueOn(false), buzzerDuty(0) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(temperatureLevel, mspRedOn, mspBlueOn, buzzerDuty, lastRedOn, lastBlueOn, lastBuzzerDuty);
+        }
     };
 
 #if !defined NO_LOGGING || !defined EMBED 
@@ -56,13 +77,14 @@ namespace cadmium::temperatureSystem {
      * @return output stream with sigma and lightOn already inserted.
      */
     std::ostream& operator<<(std::ostream &out, const TemperatureSignalState& state) {
-        out << ", Temperature: " << state.temperatureFound;
+        out << ", Temperature level: " << static_cast<int>(state.temperatureLevel);
         return out;
     }
 #endif
 
-    // Atomic DEVS model of TrafficLightTemperature
-    class TemperatureSignal : public Atomic<TemperatureSignalState> {
+    // Atomic DEVS model of TrafficLightTemperature, see TemperatureSignalConfig for its configuration
+    template<typename Config = TemperatureSignalConfig>
+    class TemperatureSignalModel : public Atomic<TemperatureSignalState> {
      private:
 
      public:
@@ -70,13 +92,16 @@ namespace cadmium::temperatureSystem {
         // Declare ports for the model
 
         // Input ports
-        Port<double> acquiredTemperature;
+        shared::BoundedPort<uint8_t, 1> inTemperatureLevel;
 
         //Output ports
-        Port<bool> outMspRed; //Update 1
-        Port<bool> outMspBlue; //Update 1
+        shared::BoundedPort<bool, 1> outMspRed; //Update 1
+        shared::BoundedPort<bool, 1> outMspBlue; //Update 1
+
+        shared::BoundedPort<int, 1> outBuzzer; //Update 2
 
-        Port<int> outBuzzer; //Update 2
+        // Declare variables for the model's behaviour
+        static constexpr double pollPeriod = Config::pollPeriod; // Delay before a change of the LEDs/buzzer is sent out
 
         /**
          * Constructor function for this atomic model, and its respective state object.
@@ -86,12 +111,12 @@ namespace cadmium::temperatureSystem {
          *
          * @param id ID of the new trafficlightTemperature model object, will be used to identify results on the output file
          */
-        TemperatureSignal(const std::string& id): Atomic<TemperatureSignalState>(id, TemperatureSignalState()) {
+        explicit TemperatureSignalModel(const std::string& id): Atomic<TemperatureSignalState>(id, TemperatureSignalState()) {
 
             // Initialize ports for the model
 
             // Input Ports
-            acquiredTemperature = addInPort<double>("acquiredTemperature");
+            inTemperatureLevel = addInPort<uint8_t>("inTemperatureLevel");
 
             // Output Ports
             outMspRed = addOutPort<bool>("outMspRed"); //Update 1
@@ -99,9 +124,7 @@ namespace cadmium::temperatureSystem {
 
             outBuzzer = addOutPort<int>("outBuzzer"); //Update 2
 
-            // Initialize variables for the model's behavior
-
-            state.sigma = 1.0;
+            state.sigma = pollPeriod;
 
         }
 
@@ -109,17 +132,17 @@ namespace cadmium::temperatureSystem {
          * The transition function is invoked each time the value of
          * state.sigma reaches 0.
          *
-         * In this model, the value of state.lightOn is toggled.
-         *
-         * With each invoke, the rgbCounter increments,
-         * then loops after case 3 back to case 0.
-         * sets the state of Red and Green lights
+         * In this model, the LED and buzzer states have just been sent, so the
+         * model goes passive until the temperature crosses the threshold again (or
+         * keeps polling when LEGACY_POLLING is defined).
          *
          * @param state reference to the current state of the model.
          */
         void internalTransition(TemperatureSignalState& state) const override {
-
-
+            state.lastRedOn.record(state.mspRedOn);
+            state.lastBlueOn.record(state.mspBlueOn);
+            state.lastBuzzerDuty.record(state.buzzerDuty);
+            state.sigma = shared::idleSigma(pollPeriod);
         }
 
         /**
@@ -131,10 +154,13 @@ namespace cadmium::temperatureSystem {
          */
         void externalTransition(TemperatureSignalState& state, double e) const override {
 
-            if(!acquiredTemperature->empty()) {
-                for(const auto i : acquiredTemperature->getBag()){
-                    state.temperatureFound = i;
-                    if(state.temperatureFound < 26.5){
+            const bool previousRedOn = state.mspRedOn;
+            const bool previousBlueOn = state.mspBlueOn;
+
+            if(!inTemperatureLevel->empty()) {
+                for(const auto level : inTemperatureLevel->getBag()){
+                    state.temperatureLevel = level;
+                    if(state.temperatureLevel == 0){
                         state.mspBlueOn = true;
                         state.mspRedOn = false;
                         state.buzzerDuty = 0;
@@ -142,12 +168,17 @@ namespace cadmium::temperatureSystem {
                     else{
                         state.mspRedOn = true;
                         state.mspBlueOn = false;
-                        state.buzzerDuty = 5;
+                        state.buzzerDuty = Config::buzzerDuty;
                     }
 
                 }
             }
 
+            // Only schedule an output when the temperature crossed the threshold
+            if(state.mspRedOn != previousRedOn || state.mspBlueOn != previousBlueOn){
+                state.sigma = pollPeriod;
+            }
+
         }
 
         /**
@@ -161,10 +192,10 @@ namespace cadmium::temperatureSystem {
          */
         void output(const TemperatureSignalState& state) const override {
 
-            outMspRed->addMessage(state.mspRedOn);
-            outMspBlue->addMessage(state.mspBlueOn);
+            shared::emitIfChanged(outMspRed, state.lastRedOn, state.mspRedOn);
+            shared::emitIfChanged(outMspBlue, state.lastBlueOn, state.mspBlueOn);
 
-            outBuzzer->addMessage(state.buzzerDuty);
+            shared::emitIfChanged(outBuzzer, state.lastBuzzerDuty, state.buzzerDuty);
 
         }
 
@@ -182,6 +213,8 @@ namespace cadmium::temperatureSystem {
 
         }
     };
+
+    using TemperatureSignal = TemperatureSignalModel<>;
 } // namespace cadmium::
 
 #endif // __TEMPERATURE_HPP__
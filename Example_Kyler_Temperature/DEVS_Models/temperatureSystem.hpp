@@ -20,37 +20,65 @@
     #include "../../IO_Models/digitalOutput.hpp"
     #include "../../IO_Models/joystickInput.hpp"
     #include "../../IO_Models/lcdOutput.hpp"
+    #include "../../IO_Models/lcdCommandOutput.hpp"
     #include "../../IO_Models/lightSensorInput.hpp"
     #include "../../IO_Models/microphoneInput.hpp"
     #include "../../IO_Models/pwmOutput.hpp"
     #include "../../IO_Models/temperatureSensorInput.hpp"
+    // Nothing wakes the interrupt-driven inputs without LowPowerRootCoordinator, so they poll then
+    #if !defined BUSY_WAIT && !defined LEGACY_POLLING
+        #include "../../IO_Models/adcDmaInput.hpp"
+    #endif
+    #ifdef PROFILE_TRANSITIONS
+        #include "../../Shared_Models/probeReporter.hpp"
+    #endif
+#elif defined BINARY_INPUT
+    #include "../../Shared_Models/binaryInputStream.hpp"
 #else
     #include <lib/iestream.hpp>
 #endif
 
 // We include any models that are directly contained within this coupled model
-#include <temperature.hpp>
+#include "../../Shared_Models/temperatureConditioner.hpp"
 #include <temperatureSignal.hpp>
+#include "../../Simulation/transitionProfiler.hpp"
 
 namespace cadmium::temperatureSystem {
     class temperatureSystem : public Coupled {
         public:
-        temperatureSystem(const std::string& id): Coupled(id){
+        /**
+         * @param id ID of the system.
+         * @param inputFolder folder holding the simulated input file (simulation only).
+         */
+        explicit temperatureSystem(const std::string& id, const std::string& inputFolder = "."): Coupled(id){
 
             // Declare and initialize all controller models (non-input/output)
-            auto temperature = addComponent<Temperature>("temperature");
-            auto temperatureSignal = addComponent<TemperatureSignal>("temperatureSignal");
+            // Averages 4 samples, shows changes of 0.1 *C, and signals from 26.5 *C until it falls under 26.3 *C
+            shared::TemperatureConditionerConfig temperatureConfig;
+            temperatureConfig.filter = shared::TemperatureFilter::MovingAverage;
+            temperatureConfig.window = 4;
+            temperatureConfig.delta = 10;
+            temperatureConfig.addThreshold(2650, 2630);
+            temperatureConfig.lcdRow = 2;
+            temperatureConfig.lcdTitle = "Temperature V2";
+            auto temperature = addComponent<Profiled<shared::TemperatureConditioner>>("temperature", temperatureConfig);
+            auto temperatureSignal = addComponent<Profiled<TemperatureSignal>>("temperatureSignal");
 
             // Connect any non-input/output models with coupling
-            addCoupling(temperature->out, temperatureSignal->acquiredTemperature);
+            addCoupling(temperature->outLevel, temperatureSignal->inTemperatureLevel);
 
 #ifdef EMBED
 
             // Declare and initialize all embedded input/output models
+            #if defined BUSY_WAIT || defined LEGACY_POLLING
             auto temperatureInput = addComponent<TemperatureSensorInput>("temperatureInput"); //MSP432 Temperature sensor
+            #else
+            // Converted by DMA, and sent as the mean of a block of 16 samples
+            auto adcInput = addComponent<AdcDmaInput>("temperatureInput", false);
+            #endif
 
             //LCD Output
-            auto lcdOutputTemperature = addComponent<LCDOutput>("lcdOutputTemperature");
+            auto lcdOutputTemperature = addComponent<LCDCommandOutput>("lcdOutputTemperature");
 
             auto mspRed = addComponent<DigitalOutput>("mspRed", GPIO_PORT_P2,GPIO_PIN0); //MSP432 Red RGB PIN0 = Red
             auto mspBlue = addComponent<DigitalOutput>("mspBlue", GPIO_PORT_P2,GPIO_PIN2); //MSP432 Red RGB PIN2 = Blue
@@ -59,7 +87,11 @@ namespace cadmium::temperatureSystem {
 
             // Connect IO models with coupling to the system
 
+            #if defined BUSY_WAIT || defined LEGACY_POLLING
             addCoupling(temperatureInput->out, temperature->inTemperature);
+            #else
+            addCoupling(adcInput->outTemperature, temperature->inTemperature);
+            #endif
 
             addCoupling(temperature->lcdTemperature, lcdOutputTemperature->in);
 
@@ -67,13 +99,23 @@ namespace cadmium::temperatureSystem {
             addCoupling(temperatureSignal->outMspBlue, mspBlue->in);
             addCoupling(temperatureSignal->outBuzzer, buzzerOutput->in);
 
+            #ifdef PROFILE_TRANSITIONS
+            // Prints the profile of the models over the UART, see Simulation/transitionProfiler.hpp
+            addComponent<shared::ProbeReporter>("probeReporter");
+            #endif
+
 #else
 
+            #ifdef BINARY_INPUT
+            // Declare and initialize the simulated input file, converted from input.txt by "make checkpoint"
+            auto textInput = addComponent<shared::BinaryInputStream<double>>("textInput",(inputFolder + "/input.bin").c_str());
+            #else
             // Declare and initialize all simulated input files (these must exist in the file system before compilation)
-            auto textInput = addComponent<cadmium::lib::IEStream<bool>>("textInput","input.txt");
+            auto textInput = addComponent<cadmium::lib::IEStream<double>>("textInput",(inputFolder + "/input.txt").c_str());
+            #endif
 
             // Connect the input files to the rest of the simulation with coupling
-            addCoupling(textInput->out,trafficLight->in);
+            addCoupling(textInput->out,temperature->inTemperature);
 
 #endif
         }
@@ -0,0 +1,12 @@
+// Benchmark of temperatureSystem: see ../Simulation/benchmark.hpp for what is measured
+// Usage: ./BlinkyBench [horizon in simulated seconds] [results.json]
+
+#include "../Simulation/benchmark.hpp"
+
+#include <temperatureSystem.hpp>
+
+using namespace cadmium::temperatureSystem;
+
+int main(int argc, char* argv[]) {
+    return cadmium::runBenchmark<temperatureSystem>("temperatureSystem", argc, argv);
+}
@@ -0,0 +1,16 @@
+// Checkpoints of temperatureSystem: see ../Simulation/checkpointRun.hpp
+// Usage: ./BlinkyCheckpoint [--resume checkpoint] [--until time] [--save checkpoint] [--log file.csv]
+// Built with BINARY_INPUT by "make checkpoint", so the input is read from input.bin.
+
+#include "../Simulation/checkpointRun.hpp"
+#include "../Shared_Models/binaryInputStream.hpp"
+#include "../Shared_Models/temperatureConditioner.hpp"
+
+#include <temperatureSystem.hpp>
+
+using namespace cadmium::temperatureSystem;
+
+int main(int argc, char* argv[]) {
+    return cadmium::runCheckpoint<temperatureSystem, cadmium::shared::TemperatureConditionerState, TemperatureSignalState,
+                                  cadmium::shared::BinaryInputStreamState>("temperatureSystem", argc, argv);
+}
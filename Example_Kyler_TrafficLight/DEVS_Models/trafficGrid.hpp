@@ -0,0 +1,343 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An atomic DEVS model running every traffic light of a grid of corridors, for
+ * simulation studies with thousands of intersections.
+ *
+ * Each intersection runs trafficLightTable, like TrafficLight, but the grid keeps
+ * them in one struct-of-arrays (TrafficGridLights) instead of one atomic model, one
+ * LCD command and one set of ports per light. The next phase boundaries are kept in
+ * a binary heap, and one internal transition advances every light whose boundary
+ * is now: with the green wave, all the lights of a column share their boundaries.
+ *
+ * Intersection i is on corridor i / columns, at column i % columns. The lights of a
+ * column start blockTravelTime seconds after those of the previous column, so a car
+ * driving along a corridor at that pace keeps meeting green lights (green wave).
+ * An input (the index of an intersection) restarts its current light, as the input
+ * of TrafficLight does.
+ *
+ * Every light that changes is sent on outSignals. The summary of the grid is sent on
+ * lcdToggle only if a display is attached, otherwise no LCD command is built.
+ */
+
+#ifndef __TRAFFIC_GRID_HPP__
+#define __TRAFFIC_GRID_HPP__
+
+// This is an atomic model, meaning it has its' own internal logic/computation
+// So, it is necessary to include atomic.hpp
+#include <modeling/devs/atomic.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../Shared_Models/lcdCommand.hpp"
+#include "trafficlight.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::trafficlightSystem {
+
+    // LEDs shown by an intersection, sent whenever they change
+    struct TrafficSignal {
+        uint32_t intersection;
+        uint8_t lights; // Bits RED_LED and GREEN_LED, both set for yellow
+
+        TrafficSignal(): intersection(0), lights(0) {}
+        TrafficSignal(uint32_t intersection, uint8_t lights): intersection(intersection), lights(lights) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    /**
+     * Insertion operator for TrafficSignal objects, used for the .csv output.
+     *
+     * @param out output stream.
+     * @param signal signal to be represented in the output stream.
+     * @return output stream with the intersection and its colour already inserted.
+     */
+    std::ostream& operator<<(std::ostream &out, const TrafficSignal& signal) {
+        static const char* const colors[4] = {"off", "red", "green", "yellow"};
+        out << signal.intersection << ":" << colors[signal.lights & 3u];
+        return out;
+    }
+#endif
+
+    /**
+     * Gives the LEDs a light shows while it is in a row of trafficLightTable: those
+     * sent when the previous row timed out, none before the first change.
+     *
+     * @param phase row of trafficLightTable.
+     * @return the LEDs shown, bits RED_LED and GREEN_LED.
+     */
+    constexpr uint8_t trafficLightShown(uint8_t phase) {
+        for (const auto& row : trafficLightTable.rows) {
+            if (row.timeout == phase) {
+                return row.outputs;
+            }
+        }
+        return 0;
+    }
+
+    // Every light of the grid, one array per field, indexed by intersection
+    struct TrafficGridLights {
+        std::vector<uint8_t> phase;     // Row of trafficLightTable
+        std::vector<double> timer;      // Simulation time of the next phase boundary
+        std::vector<double> offset;     // Start of the first phase, for the green wave
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive(phase, timer, offset);
+        }
+    };
+
+    // Phase boundary in the heap of TrafficGridState. Entries whose time no longer
+    // matches the timer of their light were superseded by a restart, and are skipped
+    using TrafficGridBoundary = std::pair<double, uint32_t>;
+
+    // A class to represent the state of this specific model
+    // All atomic models will have their own state
+    struct TrafficGridState {
+
+        // sigma is a mandatory variable for atomic models, used to advance the time of the simulation
+        double sigma;
+
+        // Declare model-specific variables
+        double clock;                                  // Simulation time of the last transition
+        TrafficGridLights lights;
+        std::vector<TrafficGridBoundary> boundaries;   // Min-heap of the next boundaries, without those in changing
+        std::vector<uint32_t> changing;                // Lights advanced by the next internal transition
+        uint32_t showing[4];                           // Number of lights showing each value of TrafficSignal::lights
+
+        // Set the default values for the state constructor for this specific model
+        TrafficGridState(): sigma(std::numeric_limits<double>::infinity()), clock(0), showing{} {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive.timeSince(clock);
+            archive(lights, boundaries, changing, showing);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    /**
+     * Insertion operator for TrafficGridState objects, used for the .csv output.
+     *
+     * @param out output stream.
+     * @param state state to be represented in the output stream.
+     * @return output stream with the number of lights of each colour already inserted.
+     */
+    std::ostream& operator<<(std::ostream &out, const TrafficGridState& state) {
+        out << ",Changing: " << state.changing.size() << ",Red: " << state.showing[1u << RED_LED]
+            << ",Green: " << state.showing[1u << GREEN_LED] << ",Yellow: " << state.showing[(1u << RED_LED) | (1u << GREEN_LED)];
+        return out;
+    }
+#endif
+
+    // Atomic DEVS model of every traffic light of trafficGridSystem
+    class TrafficGrid : public Atomic<TrafficGridState>, public TrafficLightDurations<RuntimeTrafficLightTimings> {
+     private:
+
+        // LEDs shown in each row of trafficLightTable, indexed by TrafficLightPhase
+        static constexpr uint8_t shown[4] = {trafficLightShown(RED), trafficLightShown(GREEN),
+                                             trafficLightShown(YELLOW), trafficLightShown(FIRST_RED)};
+
+        // Moves a light leaving a phase to the count of the LEDs it sends
+        static void countChange(uint32_t (&showing)[4], uint8_t phase) {
+            showing[shown[phase]]--;
+            showing[trafficLightTable.rows[phase].outputs]++;
+        }
+
+        /**
+         * Schedules the next phase boundary: moves every light whose boundary comes
+         * first from the heap to state.changing, and sets sigma to that boundary.
+         *
+         * @param state reference to the current model state.
+         */
+        void scheduleNext(TrafficGridState& state) const {
+            const auto later = std::greater<TrafficGridBoundary>();
+            state.changing.clear();
+            while (!state.boundaries.empty()) {
+                const TrafficGridBoundary next = state.boundaries.front();
+                if (!state.changing.empty() && next.first != state.lights.timer[state.changing.front()]) {
+                    break;
+                }
+                std::pop_heap(state.boundaries.begin(), state.boundaries.end(), later);
+                state.boundaries.pop_back();
+                if (next.first == state.lights.timer[next.second]) {
+                    state.changing.push_back(next.second);
+                }
+            }
+            state.sigma = state.changing.empty() ? std::numeric_limits<double>::infinity()
+                                                 : state.lights.timer[state.changing.front()] - state.clock;
+        }
+
+        // Sets the next boundary of a light, the end of its current phase
+        void startPhase(TrafficGridState& state, uint32_t light, double start) const {
+            state.lights.timer[light] = start + trafficLightTable.duration(state.lights.phase[light], durations);
+            state.boundaries.emplace_back(state.lights.timer[light], light);
+            std::push_heap(state.boundaries.begin(), state.boundaries.end(), std::greater<TrafficGridBoundary>());
+        }
+
+     public:
+
+        // Declare ports for the model
+
+        // Input ports
+        Port<int> in; // Intersection whose current light restarts
+
+        // Output ports
+        Port<TrafficSignal> outSignals;
+        Port<shared::LcdCommand> lcdToggle; // Summary of the grid, only used if displayAttached
+
+        // Declare variables for the model's behaviour
+        const uint32_t corridors;
+        const uint32_t columns;
+        const double blockTravelTime; // Time in seconds between the green lights of two columns
+        const bool displayAttached;
+
+        /**
+         * Constructor function for this atomic model, and its respective state object.
+         *
+         * @param id ID of the new TrafficGrid model object.
+         * @param corridors number of corridors (rows of the grid).
+         * @param columns number of intersections on each corridor.
+         * @param greenredLightTime time in seconds the lights stay green, and then red.
+         * @param yellowLightTime time in seconds the lights stay yellow.
+         * @param blockTravelTime time in seconds to drive from one intersection of a corridor to the next.
+         * @param displayAttached whether the summary of the grid is sent to an LCD.
+         */
+        TrafficGrid(const std::string& id, uint32_t corridors, uint32_t columns, double greenredLightTime = 6.0,
+                    double yellowLightTime = 2.0, double blockTravelTime = 4.0, bool displayAttached = false):
+            Atomic<TrafficGridState>(id, TrafficGridState()),
+            TrafficLightDurations<RuntimeTrafficLightTimings>(greenredLightTime, yellowLightTime),
+            corridors(corridors), columns(columns), blockTravelTime(blockTravelTime), displayAttached(displayAttached) {
+
+            // Initialize ports for the model
+
+            // Input Ports
+            in = addInPort<int>("in");
+
+            // Output Ports
+            outSignals = addOutPort<TrafficSignal>("outSignals");
+            lcdToggle = addOutPort<shared::LcdCommand>("lcdToggle");
+
+            // Every light starts red, the lights of each column one block later than the previous column
+            const uint32_t count = corridors * columns;
+            const double cycle = 2 * greenredLightTime + yellowLightTime;
+            state.lights.phase.assign(count, FIRST_RED);
+            state.lights.timer.resize(count);
+            state.lights.offset.resize(count);
+            state.boundaries.reserve(count);
+            state.changing.reserve(count);
+            for (uint32_t i = 0; i < count; i++) {
+                state.lights.offset[i] = cycle > 0 ? std::fmod((i % columns) * blockTravelTime, cycle) : 0.0;
+                startPhase(state, i, state.lights.offset[i]);
+            }
+            state.showing[shown[FIRST_RED]] = count;
+            scheduleNext(state);
+
+            if (displayAttached) {
+                lcdToggle->addMessage(shared::LcdCommand(0, 0, "Traffic Grid"));
+            }
+        }
+
+        /**
+         * The transition function is invoked each time the value of
+         * state.sigma reaches 0.
+         *
+         * In this model, every light in state.changing moves to the next row of
+         * trafficLightTable, then the next boundary is scheduled.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(TrafficGridState& state) const override {
+            state.clock += state.sigma;
+            for (const uint32_t light : state.changing) {
+                uint8_t& phase = state.lights.phase[light];
+                countChange(state.showing, phase);
+                phase = trafficLightTable.rows[phase].timeout;
+                startPhase(state, light, state.clock);
+            }
+            scheduleNext(state);
+        }
+
+        /**
+         * The external transition function is invoked each time external data
+         * is sent to an input port for this model.
+         *
+         * In this model, each intersection received restarts its current light.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(TrafficGridState& state, double e) const override {
+            state.clock += e;
+
+            // The lights due at the next boundary go back to the heap, some of them may restart
+            for (const uint32_t light : state.changing) {
+                state.boundaries.emplace_back(state.lights.timer[light], light);
+                std::push_heap(state.boundaries.begin(), state.boundaries.end(), std::greater<TrafficGridBoundary>());
+            }
+
+            for (const int intersection : in->getBag()) {
+                if (intersection < 0 || static_cast<uint32_t>(intersection) >= state.lights.phase.size()) {
+                    continue;
+                }
+                const auto light = static_cast<uint32_t>(intersection);
+                // A light restarted again at the same time keeps its boundary, already in the heap
+                if (state.clock + trafficLightTable.duration(state.lights.phase[light], durations) != state.lights.timer[light]) {
+                    startPhase(state, light, state.clock);
+                }
+            }
+            scheduleNext(state);
+        }
+
+        /**
+         * This function outputs any desired state values to their associated ports.
+         *
+         * In this model, the new LEDs of every light in state.changing are sent on
+         * outSignals, followed by the summary of the grid if a display is attached.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const TrafficGridState& state) const override {
+            for (const uint32_t light : state.changing) {
+                outSignals->addMessage(TrafficSignal(light, trafficLightTable.rows[state.lights.phase[light]].outputs));
+            }
+
+            if (displayAttached) {
+                uint32_t showing[4] = {state.showing[0], state.showing[1], state.showing[2], state.showing[3]};
+                for (const uint32_t light : state.changing) {
+                    countChange(showing, state.lights.phase[light]);
+                }
+                shared::LcdCommand summary(0, 1, "R");
+                summary.append(static_cast<long>(showing[1u << RED_LED])).append(" G");
+                summary.append(static_cast<long>(showing[1u << GREEN_LED])).append(" Y");
+                summary.append(static_cast<long>(showing[(1u << RED_LED) | (1u << GREEN_LED)]));
+                lcdToggle->addMessage(summary);
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * This function is the same for all models, and does not need to be changed.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const TrafficGridState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::trafficlightSystem
+
+#endif // __TRAFFIC_GRID_HPP__
@@ -0,0 +1,66 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * A coupled DEVS model of a grid of corridors with coordinated traffic lights,
+ * generalizing trafficlightSystem (one light) for simulation studies.
+ *
+ * Every light is run by a single TrafficGrid model. Restarts of the lights are read
+ * from gridInput.txt ("time intersection" on every line).
+ *
+ * This model has no embedded IO: the MSP432 build keeps using trafficlightSystem.
+ */
+
+#ifndef __TRAFFIC_GRID_SYSTEM_HPP__
+#define __TRAFFIC_GRID_SYSTEM_HPP__
+
+// This is a coupled model, meaning it has no internal computation, and is
+// used to connect atomic models.  So, it is necessary to include coupled.hpp
+#include <modeling/devs/coupled.hpp>
+#ifdef BINARY_INPUT
+    #include "../../Shared_Models/binaryInputStream.hpp"
+#else
+    #include <lib/iestream.hpp>
+#endif
+#include <string>
+
+// We include any models that are directly contained within this coupled model
+#include "trafficGrid.hpp"
+#include "../../Simulation/transitionProfiler.hpp"
+
+namespace cadmium::trafficlightSystem {
+    class trafficGridSystem : public Coupled {
+        public:
+        /**
+         * @param id ID of the system.
+         * @param corridors number of corridors (rows of the grid).
+         * @param columns number of intersections on each corridor.
+         * @param greenredLightTime time in seconds the lights stay green, and then red.
+         * @param yellowLightTime time in seconds the lights stay yellow.
+         * @param blockTravelTime time in seconds to drive from one intersection of a corridor to the next.
+         * @param displayAttached whether the summary of the grid is sent to an LCD (logged on the desktop).
+         * @param inputFolder folder holding gridInput.txt.
+         */
+        trafficGridSystem(const std::string& id, uint32_t corridors = 40, uint32_t columns = 50, double greenredLightTime = 6.0,
+                          double yellowLightTime = 2.0, double blockTravelTime = 4.0, bool displayAttached = false,
+                          const std::string& inputFolder = "."): Coupled(id){
+
+            // Declare and initialize all controller models (non-input/output)
+            auto grid = addComponent<Profiled<TrafficGrid>>("trafficGrid", corridors, columns, greenredLightTime,
+                                                            yellowLightTime, blockTravelTime, displayAttached);
+
+#ifdef BINARY_INPUT
+            // Declare and initialize the simulated input file, converted from gridInput.txt by ../Tools/textInputToBinary int
+            auto gridInput = addComponent<shared::BinaryInputStream<int>>("gridInput",(inputFolder + "/gridInput.bin").c_str());
+#else
+            // Declare and initialize the simulated input file (it must exist in the file system before running)
+            auto gridInput = addComponent<cadmium::lib::IEStream<int>>("gridInput",(inputFolder + "/gridInput.txt").c_str());
+#endif
+
+            // Connect the input file to the rest of the simulation with coupling
+            addCoupling(gridInput->out, grid->in);
+        }
+    };
+} // namespace cadmium::trafficlightSystem
+
+#endif // __TRAFFIC_GRID_SYSTEM_HPP__
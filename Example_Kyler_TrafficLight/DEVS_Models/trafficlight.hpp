@@ -13,12 +13,74 @@
 // This is an atomic model, meaning it has its' own internal logic/computation
 // So, it is necessary to include atomic.hpp
 #include <modeling/devs/atomic.hpp>
+#include "../../Shared_Models/lcdCommand.hpp"
+#include "../../Shared_Models/lastEmitted.hpp"
+#include "../../Shared_Models/boundedPort.hpp"
+#include "../../Shared_Models/tableMachine.hpp"
+#include "../../Simulation/latency.hpp"
 
 #if !defined NO_LOGGING || !defined EMBED
     #include <iostream>
 #endif
 
 namespace cadmium::trafficlightSystem {
+
+    // With LATENCY_PROBES, how far each change of light is from the nominal duration of the light
+    LATENCY_SPAN(phaseJitter);
+
+    // Default durations of the lights, folded into TrafficLight at compile time
+    struct TrafficLightTimings {
+        static constexpr double greenredLightTime = 6.0; // Time in seconds the light stays green, and then red
+        static constexpr double yellowLightTime = 2.0;   // Time in seconds the light stays yellow
+    };
+
+    // Durations given to the constructor instead, for the parameter sweeps (see sweep.cpp)
+    struct RuntimeTrafficLightTimings {};
+
+    // Durations of the lights used by TrafficLightModel: constants of Timings, or fields set by the constructor.
+    // durations is indexed by the rows of trafficLightTable
+    template<typename Timings>
+    struct TrafficLightDurations {
+        static constexpr double greenredLightTime = Timings::greenredLightTime;
+        static constexpr double yellowLightTime = Timings::yellowLightTime;
+        static constexpr double durations[2] = {greenredLightTime, yellowLightTime};
+    };
+
+    template<>
+    struct TrafficLightDurations<RuntimeTrafficLightTimings> {
+        const double greenredLightTime;
+        const double yellowLightTime;
+        const double durations[2];
+
+        TrafficLightDurations(double greenredLightTime, double yellowLightTime):
+            greenredLightTime(greenredLightTime), yellowLightTime(yellowLightTime), durations{greenredLightTime, yellowLightTime} {}
+    };
+
+    // Lights of the traffic light, in the order of the rows of trafficLightTable
+    enum TrafficLightPhase : uint8_t {
+        RED,
+        GREEN,
+        YELLOW,
+        FIRST_RED // Red shown at start-up, which lasts greenredLightTime instead of yellowLightTime
+    };
+
+    enum TrafficLightOutput : uint8_t { RED_LED, GREEN_LED };      // Bits of the outputs
+    enum TrafficLightDuration : uint8_t { GREENRED_TIME, YELLOW_TIME }; // Indexes of TrafficLightDurations::durations
+    enum TrafficLightEvent : uint8_t { RESTART };                   // Any input restarts the current light
+
+    // The LEDs of a row are sent when it times out, so they show during the next row: red for
+    // greenredLightTime, then green for greenredLightTime, then yellow (red and green LEDs) for
+    // yellowLightTime, as the original rgbCounter did.
+    constexpr shared::MachineTable<4, 1, 2> trafficLightTable{{
+        // duration      timeout  outputs                                RESTART
+        {YELLOW_TIME,    GREEN,   1u << RED_LED,                         {RED}},
+        {GREENRED_TIME,  YELLOW,  1u << GREEN_LED,                       {GREEN}},
+        {GREENRED_TIME,  RED,     (1u << RED_LED) | (1u << GREEN_LED),   {YELLOW}},
+        {GREENRED_TIME,  GREEN,   1u << RED_LED,                         {FIRST_RED}}
+    }};
+
+    static_assert(trafficLightTable.valid(), "trafficLightTable must only reference its rows and the two durations");
+
     // A class to represent the state of this specific model
     // All atomic models will have their own state
     struct TrafficLightState {
@@ -30,15 +92,22 @@ namespace cadmium::trafficlightSystem {
         bool lightOn;
         bool fastToggle;
 
-        bool mspRedOn;   //Red light LED2 (Update 1)
-        bool mspGreenOn; //Green light LED2 (Update 1)
+        shared::MachineRun machine; //Current light in trafficLightTable, and the LEDs last sent (Update 1)
 
-        int rgbCounter; //counter for the next light state
+        shared::LcdCommand currentToggle; //LCD command used to display
 
-        std::string currentToggle; //String used to display
+        //Last value sent on the LCD port, used to skip repeated messages
+        shared::LastEmitted<shared::LcdCommand> lastToggle;
 
         // Set the default values for the state constructor for this specific model
-        TrafficLightState(): sigma(0), lightOn(false), fastToggle(false), mspRedOn(true), mspGreenOn(false), rgbCounter(0) {}
+        TrafficLightState(): sigma(0), lightOn(false), fastToggle(false), machine(FIRST_RED) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(lightOn, fastToggle, machine.current, machine.lastOutputs, machine.sent);
+            archive(currentToggle, lastToggle);
+        }
     };
 
 #if !defined NO_LOGGING || !defined EMBED 
@@ -49,7 +118,8 @@ namespace cadmium::trafficlightSystem {
      *
      * In this model, each time the internal transition function is invoked the current
      * output from the out port is listed, followed by the model's current state for
-     * state.lightOn, and state.sigma.
+     * state.lightOn, and state.sigma. The light and its LEDs are read from trafficLightTable,
+     * with the start-up red listed as the red light.
      *
      * Note that state.sigma is NOT mandatory to include here, but it is listed due to
      * the desired program logic.
@@ -59,32 +129,41 @@ namespace cadmium::trafficlightSystem {
      * @return output stream with sigma and lightOn already inserted.
      */
     std::ostream& operator<<(std::ostream &out, const TrafficLightState& state) {
-        out << ", Status: " << state.lightOn << ", sigma: " << state.sigma << ", rgbCounter: " << stage.rgbCounter
-            << ", Red Light: " << state.mspRedOn << ", Green Light: " << state.mspGreenOn;
+        const uint8_t phase = state.machine.current == FIRST_RED ? static_cast<uint8_t>(RED) : state.machine.current;
+        out << ", Status: " << state.lightOn << ", sigma: " << state.sigma << ", rgbCounter: " << static_cast<int>(phase)
+            << ", Red Light: " << trafficLightTable.output(state.machine, RED_LED)
+            << ", Green Light: " << trafficLightTable.output(state.machine, GREEN_LED);
         return out;
     }
 #endif
 
-    // Atomic DEVS model of Blinky2
-    class TrafficLight : public Atomic<TrafficLightState> {
+    // Atomic DEVS model of Blinky2, see TrafficLightTimings for the durations of the lights
+    template<typename Timings = TrafficLightTimings>
+    class TrafficLightModel : public Atomic<TrafficLightState>, public TrafficLightDurations<Timings> {
      private:
 
+        // Whole numbers of seconds are displayed without decimals (e.g. "6s"), others with one
+        static uint8_t secondsDecimals(double seconds) {
+            return seconds == static_cast<double>(static_cast<long>(seconds)) ? 0 : 1;
+        }
+
      public:
 
         // Declare ports for the model
 
         // Input ports
-        Port<bool> in;
+        shared::BoundedPort<bool, 1> in;
 
         // PWMOutput ports
-        Port<bool> outMspRed;
-        Port<bool> outMspGreen;
+        shared::BoundedPort<bool, 1> outMspRed;
+        shared::BoundedPort<bool, 1> outMspGreen;
 
         // Declare variables for the model's behaviour
-        double greenredLightTime;
-        double yellowLightTime;
+        using TrafficLightDurations<Timings>::greenredLightTime;
+        using TrafficLightDurations<Timings>::yellowLightTime;
+        using TrafficLightDurations<Timings>::durations;
 
-        Port<std::string> lcdToggle;
+        shared::BoundedPort<shared::LcdCommand, 3> lcdToggle; // The 2 rows queued by the constructor, then one per output
 
         /**
          * Constructor function for this atomic model, and its respective state object.
@@ -93,8 +172,12 @@ namespace cadmium::trafficlightSystem {
          * are created, using the same id.
          *
          * @param id ID of the new trafficlight model object, will be used to identify results on the output file
+         * @param times with RuntimeTrafficLightTimings only, the time in seconds the light stays
+         *                  green, and then red, followed by the time it stays yellow.
          */
-        TrafficLight(const std::string& id): Atomic<TrafficLightState>(id, TrafficLightState()) {
+        template<typename... Times>
+        explicit TrafficLightModel(const std::string& id, Times... times):
+            Atomic<TrafficLightState>(id, TrafficLightState()), TrafficLightDurations<Timings>{times...} {
 
             // Initialize ports for the model
 
@@ -105,70 +188,36 @@ namespace cadmium::trafficlightSystem {
             outMspRed = addOutPort<bool>("outMspRed");
             outMspGreen = addOutPort<bool>("outMspGreen");
 
-            lcdToggle = addOutPort<std::string>("lcdToggle");
+            lcdToggle = addOutPort<shared::LcdCommand>("lcdToggle");
 
             // Initialize variables for the model's behavior
-            greenredLightTime = 6.0;
-            yellowLightTime = 2.0;
-            state.sigma = greenredLightTime;
+            state.sigma = trafficLightTable.duration(state.machine.current, durations);
 
             //Set a string for each of the string variables, and send it to the
             //corresponding output port. This displays the initial strings on the LCD screen
             //upon debugging.
-            state.currentToggle = "BSP_LCD_DrawString(0,0,Traffic Light V1,LCD_WHITE)";
-            lcdToggle->addMessage(state.currentToggle);
-            state.currentToggle = "BSP_LCD_DrawString(0,1, GR = 6s Y = 2s ,LCD_WHITE)";
+            lcdToggle->addMessage(shared::LcdCommand(0, 0, "Traffic Light V1"));
+            state.currentToggle = shared::LcdCommand(0, 1, " GR = ");
+            state.currentToggle.append(greenredLightTime, secondsDecimals(greenredLightTime)).append("s Y = ");
+            state.currentToggle.append(yellowLightTime, secondsDecimals(yellowLightTime)).append("s ");
             lcdToggle->addMessage(state.currentToggle);
+            state.lastToggle.record(state.currentToggle);
         }
 
         /**
          * The transition function is invoked each time the value of
          * state.sigma reaches 0.
          *
-         * In this model, the value of state.lightOn is toggled.
-         *
-         * With each invoke, the rgbCounter increments,
-         * then loops after case 3 back to case 0.
-         * sets the state of Red and Green lights
+         * With each invoke, the light moves to the next row of trafficLightTable
+         * (red, green, yellow, then red again), which sets the Red and Green
+         * lights and the time spent in the new light.
          *
          * @param state reference to the current state of the model.
          */
         void internalTransition(TrafficLightState& state) const override {
 
-            //Increment the RGB Counter , and update the RGB states accordingly
-
-            state.rgbCounter++;
-            state.rgbCounter %= 3;
-
-            //If the Light is Green or Red, set the time to 6s
-            if(state.rgbCounter == 1 || state.rgbCounter == 2){
-                state.sigma = greenredLightTime;
-            }
-            //If the Light is Yellow, set the time to 2s
-            else{
-                state.sigma = yellowLightTime;
-            }
-
-            switch (state.rgbCounter) {
-
-                        //Red Light display
-                        case 0:
-                            state.mspRedOn = true;
-                            state.mspGreenOn = false;
-                            break;
-
-                        //Green Light display
-                        case 1:
-                            state.mspRedOn = false;
-                            state.mspGreenOn = true;
-                            break;
-
-                        //Yellow Light display (R + G = Y)
-                        case 2:;
-                            state.mspRedOn = true;
-                            state.mspGreenOn = true;
-                            break;
-                        }
+            state.lastToggle.record(state.currentToggle);
+            state.sigma = trafficLightTable.timeout(state.machine, durations);
         }
 
         /**
@@ -179,7 +228,9 @@ namespace cadmium::trafficlightSystem {
          * @param e time elapsed since the last state transition function was triggered.
          */
         void externalTransition(TrafficLightState& state, double e) const override {
-
+            // An input restarts the current light, with the duration of its row
+            trafficLightTable.react(state.machine, RESTART, state.sigma, durations);
+            LATENCY_START(phaseJitter);
         }
 
         /**
@@ -193,10 +244,17 @@ namespace cadmium::trafficlightSystem {
          */
         void output(const TrafficLightState& state) const override {
 
-            outMspRed->addMessage(state.mspRedOn); //Update 1
-            outMspGreen->addMessage(state.mspGreenOn); //Update 1
+            LATENCY_JITTER(phaseJitter, trafficLightTable.duration(state.machine.current, durations));
 
-            lcdToggle->addMessage(state.currentToggle);
+            const uint8_t changed = trafficLightTable.changedOutputs(state.machine);
+            if ((changed >> RED_LED) & 1u) {
+                outMspRed->addMessage(trafficLightTable.output(state.machine, RED_LED)); //Update 1
+            }
+            if ((changed >> GREEN_LED) & 1u) {
+                outMspGreen->addMessage(trafficLightTable.output(state.machine, GREEN_LED)); //Update 1
+            }
+
+            shared::emitIfChanged(lcdToggle, state.lastToggle, state.currentToggle);
 
         }
 
@@ -214,6 +272,8 @@ namespace cadmium::trafficlightSystem {
 
         }
     };
+
+    using TrafficLight = TrafficLightModel<>;
 } // namespace cadmium::trafficlightSystem
 
 #endif // __TRAFFIC_HPP__
@@ -0,0 +1,24 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Online metrics of the TrafficLight example, compiled only with ONLINE_METRICS
+ * (see Simulation/metrics.hpp).
+ *
+ * trafficRed, trafficGreen and trafficYellow are the durations of the phases of
+ * the light, told apart by the red and green LEDs (both on while yellow) and
+ * measured by the phaseObserver of trafficlightSystem. A restart cuts a phase short.
+ */
+
+#ifndef __TRAFFIC_LIGHT_METRICS_HPP__
+#define __TRAFFIC_LIGHT_METRICS_HPP__
+
+#include "../../Simulation/metrics.hpp"
+
+namespace cadmium::trafficlightSystem {
+    METRIC_SUMMARY(trafficRed, "s");
+    METRIC_SUMMARY(trafficGreen, "s");
+    METRIC_SUMMARY(trafficYellow, "s");
+} // namespace cadmium::trafficlightSystem
+
+#endif // __TRAFFIC_LIGHT_METRICS_HPP__
@@ -20,39 +20,93 @@
     #include "../../IO_Models/digitalOutput.hpp"
     #include "../../IO_Models/joystickInput.hpp"
     #include "../../IO_Models/lcdOutput.hpp"
+    #include "../../IO_Models/lcdCommandOutput.hpp"
     #include "../../IO_Models/lightSensorInput.hpp"
     #include "../../IO_Models/microphoneInput.hpp"
     #include "../../IO_Models/pwmOutput.hpp"
     #include "../../IO_Models/temperatureSensorInput.hpp"
+    // Nothing wakes the interrupt-driven inputs without LowPowerRootCoordinator, so they poll then
+    #if !defined BUSY_WAIT && !defined LEGACY_POLLING
+        #include "../../IO_Models/digitalInterruptInput.hpp"
+    #endif
+    #if defined LATENCY_PROBES || defined PROFILE_TRANSITIONS || defined ONLINE_METRICS
+        #include "../../Shared_Models/probeReporter.hpp"
+    #endif
+#elif defined BINARY_INPUT
+    #include "../../Shared_Models/binaryInputStream.hpp"
 #else
     #include <lib/iestream.hpp>
 #endif
 
 // We include any models that are directly contained within this coupled model
 #include <trafficlight.hpp>
+#include "../../Simulation/transitionProfiler.hpp"
+#include "../../Shared_Models/metricObservers.hpp"
+#include "trafficlightMetrics.hpp"
 
 namespace cadmium::trafficlightSystem {
     class trafficlightSystem : public Coupled {
         public:
-        trafficlightSystem(const std::string& id): Coupled(id){
+        /**
+         * System with the default durations of the lights (see TrafficLightTimings), known at compile time.
+         *
+         * @param id ID of the system.
+         * @param inputFolder folder holding the simulated input file (simulation only).
+         */
+        explicit trafficlightSystem(const std::string& id, const std::string& inputFolder = "."): Coupled(id){
 
             // Declare and initialize all controller models (non-input/output)
-            auto trafficlight = addComponent<TrafficLight>("trafficLight");
+            couple(addComponent<Profiled<TrafficLight>>("trafficLight"), inputFolder);
+        }
+
+        /**
+         * System with durations of the lights chosen at run time, e.g. by the parameter sweeps.
+         *
+         * @param id ID of the system.
+         * @param greenredLightTime time in seconds the light stays green, and then red.
+         * @param yellowLightTime time in seconds the light stays yellow.
+         * @param inputFolder folder holding the simulated input file (simulation only).
+         */
+        trafficlightSystem(const std::string& id, double greenredLightTime, double yellowLightTime,
+                           const std::string& inputFolder = "."): Coupled(id){
+
+            // Declare and initialize all controller models (non-input/output)
+            couple(addComponent<Profiled<TrafficLightModel<RuntimeTrafficLightTimings>>>("trafficLight",
+                                                                                          greenredLightTime, yellowLightTime), inputFolder);
+        }
+
+        private:
+        // Adds the input/output models of the system around the traffic light
+        template<typename Light>
+        void couple(const std::shared_ptr<Light>& trafficlight, const std::string& inputFolder) {
 
             // Connect any non-input/output models with coupling
             // (NOT APPLICABLE FOR THIS MODEL)
 
+#ifdef ONLINE_METRICS
+            // Measures the phases of the light: red only, green only, and both while yellow
+            auto phaseObserver = addComponent<shared::PhaseObserver<bool, 2>>("phaseObserver",
+                std::array<MetricSummary*, 4>{nullptr, &trafficRed, &trafficGreen, &trafficYellow});
+            addCoupling(trafficlight->outMspRed, phaseObserver->in[0]);
+            addCoupling(trafficlight->outMspGreen, phaseObserver->in[1]);
+#endif
+
 #ifdef EMBED
 
             // Declare and initialize all embedded input/output models
+#if defined BUSY_WAIT || defined LEGACY_POLLING
             auto digitalInput = addComponent<DigitalInput>("digitalInput",GPIO_PORT_P5,GPIO_PIN1);
+#else
+            // Woken by GPIO edges instead of polling
+            auto digitalInput = addComponent<DigitalInterruptInput>("digitalInput",GPIO_PORT_P5,GPIO_PIN1);
+#endif
 
             //PWM Outputs
             auto mspRed = addComponent<DigitalOutput>("mspRed", GPIO_PORT_P2,GPIO_PIN0); //MSP432 Red RGB PIN0 = Red
             auto mspGreen = addComponent<DigitalOutput>("mspGreen", GPIO_PORT_P2,GPIO_PIN1); //MSP432 Red RGB PIN1 = Green
 
             //LCD Output
-            auto lcdOutputToggle = addComponent<LCDOutput>("lcdOutputToggle");
+            auto lcdOutputToggle = addComponent<LCDCommandOutput>("lcdOutputToggle");
             auto lcdOutputTemperature = addComponent<LCDOutput>("lcdOutputTemperature");
 
             // Connect IO models with coupling to the system
@@ -67,13 +121,23 @@ namespace cadmium::trafficlightSystem {
             //LCD Output
             addCoupling(trafficlight->lcdToggle, lcdOutputToggle->in);
 
+#if defined LATENCY_PROBES || defined PROFILE_TRANSITIONS || defined ONLINE_METRICS
+            // Prints the latency histograms, the profile of the models and the metrics over the UART
+            addComponent<shared::ProbeReporter>("probeReporter");
+#endif
+
 #else
 
+            #ifdef BINARY_INPUT
+            // Declare and initialize the simulated input file, converted from input.txt by "make checkpoint"
+            auto textInput = addComponent<shared::BinaryInputStream<bool>>("textInput",(inputFolder + "/input.bin").c_str());
+            #else
             // Declare and initialize all simulated input files (these must exist in the file system before compilation)
-            auto textInput = addComponent<cadmium::lib::IEStream<bool>>("textInput","input.txt");
+            auto textInput = addComponent<cadmium::lib::IEStream<bool>>("textInput",(inputFolder + "/input.txt").c_str());
+            #endif
 
             // Connect the input files to the rest of the simulation with coupling
-            addCoupling(textInput->out,trafficLight->in);
+            addCoupling(textInput->out,trafficlight->in);
 
 #endif
         }
@@ -0,0 +1,12 @@
+// Benchmark of trafficlightSystem: see ../Simulation/benchmark.hpp for what is measured
+// Usage: ./BlinkyBench [horizon in simulated seconds] [results.json]
+
+#include "../Simulation/benchmark.hpp"
+
+#include <trafficlightSystem.hpp>
+
+using namespace cadmium::trafficlightSystem;
+
+int main(int argc, char* argv[]) {
+    return cadmium::runBenchmark<trafficlightSystem>("trafficlightSystem", argc, argv);
+}
@@ -0,0 +1,15 @@
+// Checkpoints of trafficlightSystem: see ../Simulation/checkpointRun.hpp
+// Usage: ./BlinkyCheckpoint [--resume checkpoint] [--until time] [--save checkpoint] [--log file.csv]
+// Built with BINARY_INPUT by "make checkpoint", so the input is read from input.bin.
+
+#include "../Simulation/checkpointRun.hpp"
+#include "../Shared_Models/binaryInputStream.hpp"
+
+#include <trafficlightSystem.hpp>
+
+using namespace cadmium::trafficlightSystem;
+
+int main(int argc, char* argv[]) {
+    return cadmium::runCheckpoint<trafficlightSystem, TrafficLightState,
+                                  cadmium::shared::BinaryInputStreamState>("trafficlightSystem", argc, argv);
+}
@@ -0,0 +1,62 @@
+// Simulation of trafficGridSystem: corridors of coordinated traffic lights, see DEVS_Models/trafficGridSystem.hpp
+// Usage: ./BlinkyGrid [--corridors 40] [--columns 50] [--green 6] [--yellow 2] [--block 4]
+//                     [--display] [--inputs .] [--horizon 3600]
+// The log is written to trafficGridLog.csv (or trafficGridLog.bin with BINARY_LOGGING).
+
+#include <simulation/root_coordinator.hpp>
+#include "../Simulation/commandLine.hpp"
+#if defined NO_LOGGING
+#elif defined BINARY_LOGGING
+    #include "../Simulation/binaryLogger.hpp"
+#else
+    #include <simulation/logger/csv.hpp>
+#endif
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <trafficGridSystem.hpp>
+
+using namespace cadmium::trafficlightSystem;
+
+int main(int argc, char* argv[]) {
+    long corridors = 40;
+    long columns = 50;
+    double greenredLightTime = 6.0;
+    double yellowLightTime = 2.0;
+    double blockTravelTime = 4.0;
+    bool displayAttached = false;
+    std::string inputFolder = ".";
+    double horizon = 3600.0;
+
+    if (!cadmium::parseCommandLine(argc, argv, {
+            {"--corridors", "40", cadmium::integerOption(corridors)},
+            {"--columns", "50", cadmium::integerOption(columns)},
+            {"--green", "6", cadmium::numberOption(greenredLightTime)},
+            {"--yellow", "2", cadmium::numberOption(yellowLightTime)},
+            {"--block", "4", cadmium::numberOption(blockTravelTime)},
+            {"--display", nullptr, cadmium::flagOption(displayAttached)},
+            {"--inputs", ".", cadmium::textOption(inputFolder)},
+            {"--horizon", "3600", cadmium::numberOption(horizon)}})) {
+        return 1;
+    }
+    if (corridors < 1 || columns < 1 || greenredLightTime <= 0 || yellowLightTime <= 0) {
+        std::cerr << "The grid needs at least one intersection, and the lights positive durations" << std::endl;
+        return 1;
+    }
+
+    auto model = std::make_shared<trafficGridSystem>("trafficGridSystem", corridors, columns, greenredLightTime,
+                                                     yellowLightTime, blockTravelTime, displayAttached, inputFolder);
+    auto rootCoordinator = cadmium::RootCoordinator(model);
+#if defined NO_LOGGING
+#elif defined BINARY_LOGGING
+    rootCoordinator.setLogger<cadmium::BinaryLogger>("trafficGridLog.bin", ",");
+#else
+    rootCoordinator.setLogger<cadmium::CSVLogger>("trafficGridLog.csv", ",");
+#endif
+    rootCoordinator.start();
+    rootCoordinator.simulate(horizon);
+    rootCoordinator.stop();
+    return 0;
+}
@@ -0,0 +1,65 @@
+// Parameter sweep of trafficlightSystem: see ../Simulation/sweep.hpp
+// Usage: ./BlinkySweep [--green 4,6,8] [--yellow 1,2] [--inputs .,traces/a] [--horizon 1000]
+//                      [--threads 0] [--output trafficlightSweep.csv]
+// Every combination of the listed values is simulated once.
+
+#include "../Simulation/commandLine.hpp"
+#include "../Simulation/sweep.hpp"
+
+#include <fstream>
+#include <iostream>
+
+#include <trafficlightSystem.hpp>
+
+using namespace cadmium::trafficlightSystem;
+
+int main(int argc, char* argv[]) {
+    std::vector<double> greenTimes = {6.0};
+    std::vector<double> yellowTimes = {2.0};
+    std::vector<std::string> inputFolders = {"."};
+    double horizon = 1000.0;
+    unsigned threads = 0;
+    std::string outputPath = "trafficlightSweep.csv";
+
+    if (!cadmium::parseCommandLine(argc, argv, {
+            {"--green", "4,6,8", [&greenTimes](const std::string& value) { greenTimes = cadmium::parseNumberList(value); }},
+            {"--yellow", "1,2", [&yellowTimes](const std::string& value) { yellowTimes = cadmium::parseNumberList(value); }},
+            {"--inputs", ".,traces/a", [&inputFolders](const std::string& value) { inputFolders = cadmium::splitList(value); }},
+            {"--horizon", "1000", cadmium::numberOption(horizon)},
+            {"--threads", "0", cadmium::integerOption(threads)},
+            {"--output", "trafficlightSweep.csv", cadmium::textOption(outputPath)}})) {
+        return 1;
+    }
+
+    struct Variant {
+        double greenredLightTime;
+        double yellowLightTime;
+        std::string inputFolder;
+    };
+    std::vector<Variant> variants;
+    std::vector<std::string> parameters;
+    for (const auto& inputFolder : inputFolders) {
+        for (const double green : greenTimes) {
+            for (const double yellow : yellowTimes) {
+                variants.push_back({green, yellow, inputFolder});
+                parameters.push_back(cadmium::numberText(green) + "," + cadmium::numberText(yellow) + "," + cadmium::csvString(inputFolder));
+            }
+        }
+    }
+
+    std::ofstream out(outputPath);
+    if (!out) {
+        std::cerr << "sweep: cannot create " << outputPath << std::endl;
+        return 1;
+    }
+
+    const auto results = cadmium::runSweep(variants.size(), [&variants](std::size_t i) {
+        const Variant& variant = variants[i];
+        return std::make_shared<trafficlightSystem>("trafficlightSystem", variant.greenredLightTime,
+                                                    variant.yellowLightTime, variant.inputFolder);
+    }, horizon, threads);
+
+    cadmium::writeSweepCsv(out, "greenredLightTime,yellowLightTime,inputs", parameters, results);
+    std::cout << results.size() << " runs written to " << outputPath << std::endl;
+    return 0;
+}
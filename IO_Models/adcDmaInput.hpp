@@ -0,0 +1,348 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An input DEVS model for the MSP432P401R Microcontroller used with the
+ * Educational Boosterpack MK II.
+ *
+ * AdcDmaInput converts the die temperature sensor and, optionally, the joystick in a
+ * single ADC14 sequence, and sends one event per block of samples instead of one per
+ * sample as TemperatureSensorInput and JoystickInput do:
+ *  - Timer_A2, clocked by ACLK, triggers ADC14 to convert the temperature sensor
+ *    (A22, MEM0), then the joystick X (A15, MEM1) and Y (A9, MEM2), sampleRate times
+ *    per second for each channel
+ *  - at the end of each sequence, the DMA (channel 7, in ping-pong mode) copies the
+ *    results into a circular buffer of two blocks of ADC_DMA_BLOCK sequences; its
+ *    interrupt handler only points the finished half of the ping-pong to the next
+ *    free sequence, and wakes the coordinator once a block is full
+ *  - the model then sends, once per block, the mean temperature on outTemperature,
+ *    in degrees Celsius times 100000 as TemperatureSensorInput sends it (the unit
+ *    TemperatureConditioner reads), the mean of each joystick axis on outX and outY when it moved by
+ *    more than threshold (10 bits, 0 to 1023, as read by BSP_Joystick_Input), and the
+ *    raw samples of the block on outBlock, for models needing more than the mean
+ * The models keeping only the last value of their input bag (TemperatureConditioner,
+ * GarageLock) thus make one transition per block, i.e. every ADC_DMA_BLOCK / sampleRate
+ * seconds. A block has to be sent before the DMA fills it again, one block later.
+ *
+ * The model takes ADC14 and DMA channel 7 for itself, so it cannot be used with
+ * TemperatureSensorInput, JoystickInput or JoystickInterruptInput. Use it with
+ * LowPowerRootCoordinator, see Simulation/interruptSource.hpp; the ADC needs its
+ * clock, so the board can only sleep in LPM0.
+ */
+
+#ifndef __ADC_DMA_INPUT_HPP__
+#define __ADC_DMA_INPUT_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <msp.h>
+#include <adc14.h>
+#include <cs.h>
+#include <dma.h>
+#include <gpio.h>
+#include <interrupt.h>
+#include <ref_a.h>
+#include <sysctl.h>
+#include <timer_a.h>
+
+#include "../Shared_Models/boundedPort.hpp"
+#include "../Shared_Models/interruptQueue.hpp"
+#include "../Shared_Models/temperatureConditioner.hpp"
+#include "../Simulation/interruptSource.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium {
+
+    // Channels of the sequence, in the order of the conversion memories
+    enum AdcDmaChannel : std::size_t {
+        ADC_DMA_TEMPERATURE,
+        ADC_DMA_X,
+        ADC_DMA_Y,
+        ADC_DMA_CHANNELS
+    };
+
+    constexpr std::size_t ADC_DMA_BLOCK = 16; // Sequences per block, i.e. samples of each channel per event
+
+    // Raw 14-bit results of a block, sent on outBlock
+    struct AdcBlock {
+        uint16_t samples[ADC_DMA_BLOCK][ADC_DMA_CHANNELS]; // Unused channels stay 0
+    };
+
+    struct AdcDmaInputState {
+        int lastX; // Position last sent
+        int lastY;
+        double sigma;
+
+        AdcDmaInputState(): lastX(512), lastY(512), sigma(std::numeric_limits<double>::infinity()) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const AdcDmaInputState& state) {
+        out << "X: " << state.lastX << ", Y: " << state.lastY;
+        return out;
+    }
+
+    std::ostream& operator<<(std::ostream &out, const AdcBlock& block) {
+        out << "Block, first sequence:";
+        for (const uint16_t sample : block.samples[0]) {
+            out << " " << sample;
+        }
+        return out;
+    }
+#endif
+
+    class AdcDmaInput : public Atomic<AdcDmaInputState>, public InterruptSource {
+        static constexpr double ACLK_FREQUENCY = 32768.0;
+        static constexpr std::size_t SEQUENCES = 2 * ADC_DMA_BLOCK; // Circular buffer of two blocks
+
+        // Mean of the samples of each channel in a block
+        struct AdcSummary {
+            uint32_t means[ADC_DMA_CHANNELS];
+        };
+
+        // DMA control structures (primary and alternate of the 8 channels), aligned as the uDMA requires
+        alignas(1024) static inline uint8_t controlTable[1024];
+
+        // Results written by the DMA, one sequence of 32-bit registers after the other (there is a single ADC14)
+        static inline uint32_t sequences[SEQUENCES][ADC_DMA_CHANNELS];
+        static inline std::size_t nextSequence = 0; // Next sequence given to a half of the ping-pong
+        static inline std::size_t channels = 0;     // Conversions per sequence
+        static inline shared::InterruptQueue<uint8_t, 2> blocks; // Blocks filled, by index in sequences
+
+        /**
+         * Points a half of the ping-pong to the next free sequence of the circular buffer.
+         *
+         * @param select UDMA_PRI_SELECT or UDMA_ALT_SELECT.
+         */
+        static void queueSequence(uint32_t select) {
+            DMA_setChannelControl(select | DMA_CH7_ADC14, UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_32 | UDMA_ARB_4);
+            DMA_setChannelTransfer(select | DMA_CH7_ADC14, UDMA_MODE_PINGPONG, const_cast<uint32_t*>(&ADC14->MEM[0]),
+                                   sequences[nextSequence], static_cast<uint32_t>(channels));
+            nextSequence = (nextSequence + 1) % SEQUENCES;
+        }
+
+        [[nodiscard]] static AdcSummary summarize(std::size_t block) {
+            AdcSummary summary = {};
+            for (std::size_t i = 0; i < ADC_DMA_BLOCK; i++) {
+                for (std::size_t channel = 0; channel < channels; channel++) {
+                    summary.means[channel] += sequences[block * ADC_DMA_BLOCK + i][channel];
+                }
+            }
+            for (std::size_t channel = 0; channel < channels; channel++) {
+                summary.means[channel] /= ADC_DMA_BLOCK;
+            }
+            return summary;
+        }
+
+        // Joystick axes are sent in 10 bits, as by BSP_Joystick_Input
+        static int axisOf(const AdcSummary& summary, AdcDmaChannel channel) {
+            return static_cast<int>(summary.means[channel] >> 4);
+        }
+
+        // Mean temperature of a block in the units of TemperatureSensorInput, degrees Celsius times 100000
+        [[nodiscard]] double sensorUnitsOf(const AdcSummary& summary) const {
+            const double celsius = (static_cast<double>(summary.means[ADC_DMA_TEMPERATURE]) - calibration30) * 55.0
+                / (calibration85 - calibration30) + 30.0;
+            return celsius * shared::SENSOR_UNITS_PER_CELSIUS;
+        }
+
+     public:
+
+        // Output ports
+        shared::BoundedPort<double, 1> outTemperature; // Degrees Celsius times 100000
+        shared::BoundedPort<int, 1> outX;
+        shared::BoundedPort<int, 1> outY;
+        shared::BoundedPort<AdcBlock, 1> outBlock;
+
+        // Declare variables for the model's behaviour
+        const bool joystick;      // Whether the joystick is converted after the temperature sensor
+        const int threshold;      // Smallest move of an axis that is sent, in ADC counts (10 bits)
+        const double sampleRate;  // Sequences converted per second
+        const double calibration30; // Results of the temperature sensor at 30 and 85 *C, from the TLV
+        const double calibration85;
+
+        /**
+         * Constructor function for this input model.
+         *
+         * @param id ID of the new AdcDmaInput model object.
+         * @param joystick whether the joystick is converted too.
+         * @param threshold smallest move of an axis that is sent, in ADC counts (0 to 1023).
+         * @param sampleRate sequences converted per second; a block is sent every ADC_DMA_BLOCK of them.
+         */
+        explicit AdcDmaInput(const std::string& id, bool joystick = true, int threshold = 32, double sampleRate = 80.0):
+            Atomic<AdcDmaInputState>(id, AdcDmaInputState()), joystick(joystick), threshold(threshold), sampleRate(sampleRate),
+            calibration30(SysCtl_getTempCalibrationConstant(SYSCTL_2_5V_REF, SYSCTL_30_DEGREES_C)),
+            calibration85(SysCtl_getTempCalibrationConstant(SYSCTL_2_5V_REF, SYSCTL_85_DEGREES_C)) {
+            outTemperature = addOutPort<double>("outTemperature");
+            outX = addOutPort<int>("outX");
+            outY = addOutPort<int>("outY");
+            outBlock = addOutPort<AdcBlock>("outBlock");
+            channels = joystick ? ADC_DMA_CHANNELS : 1;
+
+            // The temperature sensor is read against the 2.5 V reference, as calibrated in the TLV
+            REF_A_setReferenceVoltage(REF_A_VREF2_5V);
+            REF_A_enableReferenceVoltage();
+            REF_A_enableTempSensor();
+
+            ADC14_enableModule();
+            ADC14_initModule(ADC_CLOCKSOURCE_MODOSC, ADC_PREDIVIDER_1, ADC_DIVIDER_1, ADC_TEMPSENSEMAP);
+            ADC14_setResolution(ADC_14BIT);
+            ADC14_setSampleHoldTime(ADC_PULSE_WIDTH_192, ADC_PULSE_WIDTH_192); // The sensor needs at least 5 us
+            ADC14_configureConversionMemory(ADC_MEM0, ADC_VREFPOS_INTBUF_VREFNEG_VSS, ADC_INPUT_A22, false);
+            if (joystick) {
+                // X on P6.0 (A15) and Y on P4.4 (A9), as wired on the Boosterpack
+                GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P6, GPIO_PIN0, GPIO_TERTIARY_MODULE_FUNCTION);
+                GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P4, GPIO_PIN4, GPIO_TERTIARY_MODULE_FUNCTION);
+                ADC14_configureConversionMemory(ADC_MEM1, ADC_VREFPOS_AVCC_VREFNEG_VSS, ADC_INPUT_A15, false);
+                ADC14_configureConversionMemory(ADC_MEM2, ADC_VREFPOS_AVCC_VREFNEG_VSS, ADC_INPUT_A9, false);
+                ADC14_configureMultiSequenceMode(ADC_MEM0, ADC_MEM2, true);
+            } else {
+                ADC14_configureSingleSampleMode(ADC_MEM0, true);
+            }
+
+            // The end of the last conversion of a sequence requests the DMA, its interrupt stays disabled in the NVIC
+            DMA_enableModule();
+            DMA_setControlBase(controlTable);
+            DMA_assignChannel(DMA_CH7_ADC14);
+            DMA_disableChannelAttribute(DMA_CH7_ADC14, UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+            nextSequence = 0;
+            queueSequence(UDMA_PRI_SELECT);
+            queueSequence(UDMA_ALT_SELECT);
+            DMA_assignInterrupt(DMA_INT1, 7);
+            DMA_clearInterruptFlag(7);
+            Interrupt_enableInterrupt(INT_DMA_INT1);
+            DMA_enableChannel(7);
+            ADC14_enableInterrupt(1ull << (channels - 1)); // ADC_INT0 or ADC_INT2
+
+            // Each rising edge of TA2.1 converts the next channel of the sequence
+            ADC14_setSampleHoldTrigger(ADC_TRIGGER_SOURCE5, false);
+            ADC14_enableSampleTimer(ADC_MANUAL_ITERATION);
+            ADC14_enableConversion();
+
+            CS_setReferenceOscillatorFrequency(CS_REFO_32KHZ);
+            CS_initClockSignal(CS_ACLK, CS_REFOCLK_SELECT, CS_CLOCK_DIVIDER_1);
+            const auto period = static_cast<uint_fast16_t>(ACLK_FREQUENCY / (static_cast<double>(channels) * sampleRate));
+            Timer_A_PWMConfig trigger = {
+                TIMER_A_CLOCKSOURCE_ACLK,
+                TIMER_A_CLOCKSOURCE_DIVIDER_1,
+                period,
+                TIMER_A_CAPTURECOMPARE_REGISTER_1,
+                TIMER_A_OUTPUTMODE_RESET_SET,
+                static_cast<uint_fast16_t>(period / 2)
+            };
+            Timer_A_generatePWM(TIMER_A2_BASE, &trigger);
+        }
+
+        ~AdcDmaInput() override {
+            Timer_A_stopTimer(TIMER_A2_BASE);
+            ADC14_disableConversion();
+            DMA_disableChannel(7);
+            Interrupt_disableInterrupt(INT_DMA_INT1);
+        }
+
+        // Called by DMA_INT1_IRQHandler at the end of each half of the ping-pong, i.e. of each sequence
+        static void handleTransfer() {
+            DMA_clearInterruptFlag(7);
+            // The DMA moved on to the alternate structure if the primary one just finished, and back
+            const bool primaryDone = (DMA_getChannelAttribute(7) & UDMA_ATTR_ALTSELECT) != 0;
+            const std::size_t finished = (nextSequence + SEQUENCES - 2) % SEQUENCES;
+            queueSequence(primaryDone ? UDMA_PRI_SELECT : UDMA_ALT_SELECT);
+            if ((finished + 1) % ADC_DMA_BLOCK == 0) {
+                blocks.push(static_cast<uint8_t>(finished / ADC_DMA_BLOCK));
+                requestWake();
+            }
+        }
+
+        [[nodiscard]] bool moved(int value, int last) const {
+            return value > last + threshold || value < last - threshold;
+        }
+
+        [[nodiscard]] bool interruptPending() const override {
+            return !blocks.empty();
+        }
+
+        /**
+         * The transition function is invoked when a block was filled.
+         *
+         * In this model, the axes just sent are kept, and the next filled
+         * block, if any, is sent right away.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(AdcDmaInputState& state) const override {
+            if (!blocks.empty()) {
+                if (joystick) {
+                    const AdcSummary summary = summarize(blocks.front());
+                    const int x = axisOf(summary, ADC_DMA_X);
+                    const int y = axisOf(summary, ADC_DMA_Y);
+                    state.lastX = moved(x, state.lastX) ? x : state.lastX;
+                    state.lastY = moved(y, state.lastY) ? y : state.lastY;
+                }
+                blocks.pop();
+            }
+            state.sigma = blocks.empty() ? std::numeric_limits<double>::infinity() : 0;
+        }
+
+        /**
+         * This model has no input ports, so the external transition is never triggered.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(AdcDmaInputState& state, double e) const override {
+
+        }
+
+        /**
+         * Sends the summary of the filled block, and its raw samples.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const AdcDmaInputState& state) const override {
+            if (blocks.empty()) {
+                return;
+            }
+            const std::size_t block = blocks.front();
+            const AdcSummary summary = summarize(block);
+            outTemperature->addMessage(sensorUnitsOf(summary));
+            if (joystick) {
+                const int x = axisOf(summary, ADC_DMA_X);
+                const int y = axisOf(summary, ADC_DMA_Y);
+                if (moved(x, state.lastX)) {
+                    outX->addMessage(x);
+                }
+                if (moved(y, state.lastY)) {
+                    outY->addMessage(y);
+                }
+            }
+            AdcBlock samples = {};
+            for (std::size_t i = 0; i < ADC_DMA_BLOCK; i++) {
+                for (std::size_t channel = 0; channel < channels; channel++) {
+                    samples.samples[i][channel] = static_cast<uint16_t>(sequences[block * ADC_DMA_BLOCK + i][channel]);
+                }
+            }
+            outBlock->addMessage(samples);
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const AdcDmaInputState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium
+
+extern "C" void DMA_INT1_IRQHandler(void) {
+    cadmium::AdcDmaInput::handleTransfer();
+}
+
+#endif // __ADC_DMA_INPUT_HPP__
@@ -0,0 +1,234 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An input DEVS model for the MSP432P401R Microcontroller used with the
+ * Educational Boosterpack MK II.
+ *
+ * DigitalInterruptInput sends the level of a GPIO pin on its out port, like
+ * DigitalInput, but is woken by an edge interrupt instead of reading the pin on a
+ * fixed period. It stays passive while nobody touches the button, so the board can
+ * sleep (use it with LowPowerRootCoordinator, see Simulation/interruptSource.hpp):
+ *  - the interrupt handler of the port queues the new level, disables the interrupt
+ *    of the pin and wakes the coordinator, which makes the model imminent
+ *  - the model sends the level right away, then ignores the pin for debounceTime
+ *    while the contacts bounce
+ *  - it then reads the pin again, sends the level if it changed back, and re-arms the
+ *    interrupt on the edge leaving the current level
+ * The pins are read with the pull-up resistor enabled, as in DigitalInput.
+ */
+
+#ifndef __DIGITAL_INTERRUPT_INPUT_HPP__
+#define __DIGITAL_INTERRUPT_INPUT_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <gpio.h>
+#include <interrupt.h>
+
+#include "../Shared_Models/boundedPort.hpp"
+#include "../Shared_Models/interruptQueue.hpp"
+#include "../Simulation/interruptSource.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium {
+    struct DigitalInterruptInputState {
+        bool output; // Level last sent
+        double sigma;
+
+        DigitalInterruptInputState(): output(true), sigma(std::numeric_limits<double>::infinity()) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const DigitalInterruptInputState& state) {
+        out << "Pin: " << (state.output ? 1 : 0);
+        return out;
+    }
+#endif
+
+    class DigitalInterruptInput : public Atomic<DigitalInterruptInputState>, public InterruptSource {
+        static constexpr std::size_t MAX_INPUTS = 8;
+
+        // Inputs whose edges are dispatched by the PORTx interrupt handlers
+        static inline DigitalInterruptInput* inputs[MAX_INPUTS] = {};
+        static inline std::size_t inputCount = 0;
+
+        mutable shared::InterruptQueue<bool, 2> levels; // Levels after an edge, filled by the interrupt handler
+        mutable volatile bool armedLevel;               // Level the pin leaves on the edge the interrupt waits for
+
+        [[nodiscard]] bool read() const {
+            return GPIO_getInputPinValue(port, pins) == GPIO_INPUT_PIN_HIGH;
+        }
+
+        /**
+         * Enables the interrupt on the edge leaving a level.
+         *
+         * @param level current level of the pin.
+         * @return false if the pin changed while the interrupt was armed, which is then left disabled.
+         */
+        bool arm(bool level) const {
+            armedLevel = level;
+            GPIO_interruptEdgeSelect(port, pins, level ? GPIO_HIGH_TO_LOW_TRANSITION : GPIO_LOW_TO_HIGH_TRANSITION);
+            GPIO_clearInterruptFlag(port, pins);
+            // Clearing the flag may have discarded an edge that happened since the pin was read
+            if (read() != level) {
+                return false;
+            }
+            GPIO_enableInterrupt(port, pins);
+            return true;
+        }
+
+        // Called by the interrupt handler of the port
+        void edge() {
+            GPIO_disableInterrupt(port, pins);
+            levels.push(!armedLevel);
+            requestWake();
+        }
+
+        static uint32_t portInterrupt(uint_fast8_t port) {
+            switch (port) {
+                case GPIO_PORT_P1: return INT_PORT1;
+                case GPIO_PORT_P2: return INT_PORT2;
+                case GPIO_PORT_P3: return INT_PORT3;
+                case GPIO_PORT_P4: return INT_PORT4;
+                case GPIO_PORT_P5: return INT_PORT5;
+                default: return INT_PORT6;
+            }
+        }
+
+     public:
+
+        // Output ports
+        shared::BoundedPort<bool, 1> out;
+
+        // Declare variables for the model's behaviour
+        const uint_fast8_t port;
+        const uint_fast16_t pins;
+        const double debounceTime; // Time the pin is ignored after an edge
+
+        /**
+         * Constructor function for this input model.
+         *
+         * @param id ID of the new DigitalInterruptInput model object.
+         * @param selectedPort GPIO port of the pin (GPIO_PORT_P1 to GPIO_PORT_P6).
+         * @param selectedPins GPIO pin (GPIO_PINx).
+         * @param debounceTime time in seconds the pin is ignored after an edge.
+         */
+        DigitalInterruptInput(const std::string& id, uint_fast8_t selectedPort, uint_fast16_t selectedPins, double debounceTime = 0.02):
+            Atomic<DigitalInterruptInputState>(id, DigitalInterruptInputState()), levels(), armedLevel(true),
+            port(selectedPort), pins(selectedPins), debounceTime(debounceTime) {
+            out = addOutPort<bool>("out");
+
+            GPIO_setAsInputPinWithPullUpResistor(port, pins);
+            if (inputCount < MAX_INPUTS) {
+                inputs[inputCount++] = this;
+            }
+            state.output = read();
+            if (!arm(state.output)) {
+                levels.push(!state.output);
+                state.sigma = 0;
+            }
+            Interrupt_enableInterrupt(portInterrupt(port));
+        }
+
+        ~DigitalInterruptInput() override {
+            GPIO_disableInterrupt(port, pins);
+            for (std::size_t i = 0; i < inputCount; i++) {
+                if (inputs[i] == this) {
+                    inputs[i] = inputs[--inputCount];
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Dispatches the edges of a port to the models of its pins.
+         * Called by the PORTx interrupt handlers.
+         *
+         * @param port GPIO port that raised the interrupt.
+         */
+        static void handlePort(uint_fast8_t port) {
+            const uint_fast16_t flags = GPIO_getEnabledInterruptStatus(port);
+            GPIO_clearInterruptFlag(port, flags);
+            for (std::size_t i = 0; i < inputCount; i++) {
+                if (inputs[i]->port == port && (flags & inputs[i]->pins) != 0) {
+                    inputs[i]->edge();
+                }
+            }
+        }
+
+        [[nodiscard]] bool interruptPending() const override {
+            return !levels.empty();
+        }
+
+        /**
+         * The transition function is invoked after an edge and once the pin settled.
+         *
+         * After an edge, the level just sent is kept and the pin is ignored while it
+         * bounces. Once settled, the interrupt is armed again, unless the pin is back to
+         * another level, which is then sent right away.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(DigitalInterruptInputState& state) const override {
+            if (!levels.empty()) {
+                state.output = levels.front();
+                levels.pop();
+                state.sigma = debounceTime;
+                return;
+            }
+            if (read() == state.output && arm(state.output)) {
+                state.sigma = std::numeric_limits<double>::infinity();
+            } else {
+                // The interrupt of the pin is disabled, so this model is the only producer
+                levels.push(!state.output);
+                state.sigma = 0;
+            }
+        }
+
+        /**
+         * This model has no input ports, so the external transition is never triggered.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(DigitalInterruptInputState& state, double e) const override {
+
+        }
+
+        /**
+         * Sends the level of the pin after an edge.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const DigitalInterruptInputState& state) const override {
+            if (!levels.empty()) {
+                out->addMessage(levels.front());
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const DigitalInterruptInputState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium
+
+extern "C" void PORT1_IRQHandler(void) { cadmium::DigitalInterruptInput::handlePort(GPIO_PORT_P1); }
+extern "C" void PORT2_IRQHandler(void) { cadmium::DigitalInterruptInput::handlePort(GPIO_PORT_P2); }
+extern "C" void PORT3_IRQHandler(void) { cadmium::DigitalInterruptInput::handlePort(GPIO_PORT_P3); }
+extern "C" void PORT4_IRQHandler(void) { cadmium::DigitalInterruptInput::handlePort(GPIO_PORT_P4); }
+extern "C" void PORT5_IRQHandler(void) { cadmium::DigitalInterruptInput::handlePort(GPIO_PORT_P5); }
+extern "C" void PORT6_IRQHandler(void) { cadmium::DigitalInterruptInput::handlePort(GPIO_PORT_P6); }
+
+#endif // __DIGITAL_INTERRUPT_INPUT_HPP__
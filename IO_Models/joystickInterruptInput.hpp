@@ -0,0 +1,234 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An input DEVS model for the MSP432P401R Microcontroller used with the
+ * Educational Boosterpack MK II.
+ *
+ * JoystickInterruptInput sends the position of the joystick on outX and outY,
+ * like JoystickInput, but only when it moved by more than a threshold, and without
+ * the CPU reading the ADC on a fixed period:
+ *  - Timer_A2, clocked by ACLK, triggers ADC14 to convert X (A15, MEM0) then
+ *    Y (A9, MEM1), sampleRate times per second for each axis
+ *  - the window comparators of MEM0 and MEM1 are centred on the last position read,
+ *    and interrupt only when an axis leaves its window
+ *  - the ADC14 interrupt handler queues the new position, centres the windows on it
+ *    and wakes the coordinator, which makes the model imminent
+ * Values are 10 bits (0 to 1023), as read by BSP_Joystick_Input. The model takes
+ * ADC14 for itself, so it cannot be used with another model converting on the ADC
+ * (e.g. TemperatureSensorInput). Use it with LowPowerRootCoordinator, see
+ * Simulation/interruptSource.hpp; the ADC needs its clock, so the board can only
+ * sleep in LPM0.
+ */
+
+#ifndef __JOYSTICK_INTERRUPT_INPUT_HPP__
+#define __JOYSTICK_INTERRUPT_INPUT_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <cstdint>
+#include <limits>
+#include <msp.h>
+#include <adc14.h>
+#include <cs.h>
+#include <gpio.h>
+#include <interrupt.h>
+#include <timer_a.h>
+
+#include "../Shared_Models/boundedPort.hpp"
+#include "../Shared_Models/interruptQueue.hpp"
+#include "../Simulation/interruptSource.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium {
+
+    // Position of the joystick converted by ADC14
+    struct JoystickPosition {
+        int x;
+        int y;
+    };
+
+    struct JoystickInterruptInputState {
+        int lastX; // Position last sent
+        int lastY;
+        double sigma;
+
+        JoystickInterruptInputState(): lastX(512), lastY(512), sigma(std::numeric_limits<double>::infinity()) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const JoystickInterruptInputState& state) {
+        out << "X: " << state.lastX << ", Y: " << state.lastY;
+        return out;
+    }
+#endif
+
+    class JoystickInterruptInput : public Atomic<JoystickInterruptInputState>, public InterruptSource {
+        static constexpr double ACLK_FREQUENCY = 32768.0;
+
+        // Positions converted by ADC14, filled by ADC14_IRQHandler (there is a single joystick)
+        static inline shared::InterruptQueue<JoystickPosition, 8> positions;
+        static inline int windowHalfWidth = 0;
+
+        /**
+         * Centres the window comparators on a position. The thresholds can be changed while
+         * ADC14 converts, unlike the configuration set by ADC14_setComparatorWindowValue.
+         *
+         * @param position centre of the windows.
+         */
+        static void centreWindows(const JoystickPosition& position) {
+            ADC14->LO0 = static_cast<uint32_t>(position.x > windowHalfWidth ? position.x - windowHalfWidth : 0);
+            ADC14->HI0 = static_cast<uint32_t>(position.x + windowHalfWidth);
+            ADC14->LO1 = static_cast<uint32_t>(position.y > windowHalfWidth ? position.y - windowHalfWidth : 0);
+            ADC14->HI1 = static_cast<uint32_t>(position.y + windowHalfWidth);
+        }
+
+     public:
+
+        // Output ports
+        shared::BoundedPort<int, 1> outX;
+        shared::BoundedPort<int, 1> outY;
+
+        // Declare variables for the model's behaviour
+        const int threshold;     // Smallest move of an axis that is sent, in ADC counts
+        const double sampleRate; // Conversions per second of each axis
+
+        /**
+         * Constructor function for this input model.
+         *
+         * @param id ID of the new JoystickInterruptInput model object.
+         * @param threshold smallest move of an axis that is sent, in ADC counts (0 to 1023).
+         * @param sampleRate conversions per second of each axis.
+         */
+        explicit JoystickInterruptInput(const std::string& id, int threshold = 32, double sampleRate = 50.0):
+            Atomic<JoystickInterruptInputState>(id, JoystickInterruptInputState()), threshold(threshold), sampleRate(sampleRate) {
+            outX = addOutPort<int>("outX");
+            outY = addOutPort<int>("outY");
+
+            // X on P6.0 (A15) and Y on P4.4 (A9), as wired on the Boosterpack
+            GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P6, GPIO_PIN0, GPIO_TERTIARY_MODULE_FUNCTION);
+            GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P4, GPIO_PIN4, GPIO_TERTIARY_MODULE_FUNCTION);
+
+            ADC14_enableModule();
+            ADC14_initModule(ADC_CLOCKSOURCE_MODOSC, ADC_PREDIVIDER_1, ADC_DIVIDER_1, 0);
+            ADC14_setResolution(ADC_10BIT);
+            ADC14_configureMultiSequenceMode(ADC_MEM0, ADC_MEM1, true);
+            ADC14_configureConversionMemory(ADC_MEM0, ADC_VREFPOS_AVCC_VREFNEG_VSS, ADC_INPUT_A15, false);
+            ADC14_configureConversionMemory(ADC_MEM1, ADC_VREFPOS_AVCC_VREFNEG_VSS, ADC_INPUT_A9, false);
+            ADC14_enableComparatorWindow(ADC_MEM0, ADC_COMP_WINDOW0);
+            ADC14_enableComparatorWindow(ADC_MEM1, ADC_COMP_WINDOW1);
+            windowHalfWidth = threshold;
+            centreWindows({state.lastX, state.lastY});
+
+            // Each rising edge of TA2.1 converts the next axis of the sequence
+            ADC14_setSampleHoldTrigger(ADC_TRIGGER_SOURCE5, false);
+            ADC14_enableSampleTimer(ADC_MANUAL_ITERATION);
+            ADC14_clearInterruptFlag(ADC_LO_INT | ADC_HI_INT);
+            ADC14_enableInterrupt(ADC_LO_INT | ADC_HI_INT);
+            Interrupt_enableInterrupt(INT_ADC14);
+            ADC14_enableConversion();
+
+            CS_setReferenceOscillatorFrequency(CS_REFO_32KHZ);
+            CS_initClockSignal(CS_ACLK, CS_REFOCLK_SELECT, CS_CLOCK_DIVIDER_1);
+            const auto period = static_cast<uint_fast16_t>(ACLK_FREQUENCY / (2 * sampleRate));
+            Timer_A_PWMConfig trigger = {
+                TIMER_A_CLOCKSOURCE_ACLK,
+                TIMER_A_CLOCKSOURCE_DIVIDER_1,
+                period,
+                TIMER_A_CAPTURECOMPARE_REGISTER_1,
+                TIMER_A_OUTPUTMODE_RESET_SET,
+                static_cast<uint_fast16_t>(period / 2)
+            };
+            Timer_A_generatePWM(TIMER_A2_BASE, &trigger);
+        }
+
+        ~JoystickInterruptInput() override {
+            Timer_A_stopTimer(TIMER_A2_BASE);
+            ADC14_disableInterrupt(ADC_LO_INT | ADC_HI_INT);
+            ADC14_disableConversion();
+        }
+
+        // Called by ADC14_IRQHandler
+        static void handleWindow() {
+            const uint_fast64_t flags = ADC14_getEnabledInterruptStatus();
+            ADC14_clearInterruptFlag(flags);
+            const JoystickPosition position = {static_cast<int>(ADC14_getResult(ADC_MEM0)),
+                                               static_cast<int>(ADC14_getResult(ADC_MEM1))};
+            centreWindows(position);
+            positions.push(position);
+            requestWake();
+        }
+
+        [[nodiscard]] bool moved(int value, int last) const {
+            return value > last + threshold || value < last - threshold;
+        }
+
+        [[nodiscard]] bool interruptPending() const override {
+            return !positions.empty();
+        }
+
+        /**
+         * The transition function is invoked when a position was queued.
+         *
+         * In this model, the axes just sent are kept, and the next queued
+         * position, if any, is sent right away.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(JoystickInterruptInputState& state) const override {
+            if (!positions.empty()) {
+                const JoystickPosition& position = positions.front();
+                state.lastX = moved(position.x, state.lastX) ? position.x : state.lastX;
+                state.lastY = moved(position.y, state.lastY) ? position.y : state.lastY;
+                positions.pop();
+            }
+            state.sigma = positions.empty() ? std::numeric_limits<double>::infinity() : 0;
+        }
+
+        /**
+         * This model has no input ports, so the external transition is never triggered.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(JoystickInterruptInputState& state, double e) const override {
+
+        }
+
+        /**
+         * Sends each axis of the queued position that moved by more than the threshold.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const JoystickInterruptInputState& state) const override {
+            if (positions.empty()) {
+                return;
+            }
+            const JoystickPosition& position = positions.front();
+            if (moved(position.x, state.lastX)) {
+                outX->addMessage(position.x);
+            }
+            if (moved(position.y, state.lastY)) {
+                outY->addMessage(position.y);
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const JoystickInterruptInputState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium
+
+extern "C" void ADC14_IRQHandler(void) {
+    cadmium::JoystickInterruptInput::handleWindow();
+}
+
+#endif // __JOYSTICK_INTERRUPT_INPUT_HPP__
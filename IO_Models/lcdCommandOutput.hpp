@@ -0,0 +1,96 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * An output DEVS model for the MSP432P401R Microcontroller used with the
+ * Educational Boosterpack MK II.
+ *
+ * LCDCommandOutput draws each LcdCommand received on its in port with
+ * BSP_LCD_DrawString. Unlike LCDOutput, the messages are already split into
+ * column, row, text and colour, so nothing is parsed and no memory is allocated.
+ */
+
+#ifndef __LCD_COMMAND_OUTPUT_HPP__
+#define __LCD_COMMAND_OUTPUT_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <limits>
+
+// lcdOutput.hpp provides the Boosterpack LCD driver (BSP_LCD_DrawString)
+#include "lcdOutput.hpp"
+#include "../Shared_Models/lcdCommand.hpp"
+#include "../Shared_Models/boundedPort.hpp"
+
+namespace cadmium {
+    struct LCDCommandOutputState {
+        double sigma;
+
+        LCDCommandOutputState(): sigma(std::numeric_limits<double>::infinity()) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const LCDCommandOutputState& state) {
+        return out;
+    }
+#endif
+
+    class LCDCommandOutput : public Atomic<LCDCommandOutputState> {
+     public:
+
+        // Input ports
+        shared::BoundedPort<shared::LcdCommand, 8> in; // Enough for the rows queued by any model of the examples at startup
+
+        /**
+         * Constructor function for this output model.
+         *
+         * @param id ID of the new LCDCommandOutput model object.
+         */
+        LCDCommandOutput(const std::string& id): Atomic<LCDCommandOutputState>(id, LCDCommandOutputState()) {
+            in = addInPort<shared::LcdCommand>("in");
+        }
+
+        /**
+         * This model is passive, so the internal transition is never triggered.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(LCDCommandOutputState& state) const override {
+
+        }
+
+        /**
+         * Draws every received command on the LCD screen, in the order they were sent.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(LCDCommandOutputState& state, double e) const override {
+            for (const auto& command : in->getBag()) {
+                // BSP_LCD_DrawString takes a non-const pointer but does not modify the text
+                BSP_LCD_DrawString(command.col, command.row, const_cast<char*>(command.text),
+                                   static_cast<int16_t>(command.color));
+            }
+        }
+
+        /**
+         * This model has no output ports.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const LCDCommandOutputState& state) const override {
+
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const LCDCommandOutputState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium
+
+#endif // __LCD_COMMAND_OUTPUT_HPP__
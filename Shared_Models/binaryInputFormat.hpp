@@ -0,0 +1,44 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Layout of the binary input files read by BinaryInputStream and written by
+ * Tools/textInputToBinary.cpp. It only depends on the standard library, so the
+ * converter can be built without Cadmium.
+ *
+ * A file is a BinaryInputHeader followed by header.count BinaryInputRecord<T>
+ * structs, sorted by time and stored exactly as they are laid out in memory, so
+ * the records can be used straight from a memory mapping. Times are absolute
+ * simulation times, as in the text files read by IEStream. Numbers are stored in
+ * the byte order of the machine that wrote the file.
+ */
+
+#ifndef __BINARY_INPUT_FORMAT_HPP__
+#define __BINARY_INPUT_FORMAT_HPP__
+
+#include <cstdint>
+
+namespace cadmium::shared {
+
+    constexpr char BINARY_INPUT_MAGIC[4] = {'C', 'D', 'B', 'I'};
+    constexpr uint32_t BINARY_INPUT_VERSION = 1;
+
+    struct BinaryInputHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t valueSize;  // sizeof(T), checked when the file is opened
+        uint32_t recordSize; // sizeof(BinaryInputRecord<T>)
+        uint64_t count;      // Number of records following the header
+    };
+
+    template<typename T>
+    struct BinaryInputRecord {
+        double time;
+        T value;
+    };
+
+    static_assert(sizeof(BinaryInputHeader) % alignof(double) == 0, "Records must stay aligned after the header");
+
+} // namespace cadmium::shared
+
+#endif // __BINARY_INPUT_FORMAT_HPP__
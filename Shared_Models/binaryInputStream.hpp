@@ -0,0 +1,202 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * BinaryInputStream<T> plays back the events of a binary input file, like
+ * cadmium::lib::IEStream<T> does for "time value" text files. The whole file is
+ * memory mapped when the model is created and the records are used in place, so
+ * nothing is parsed or allocated per event. Files are produced from the text
+ * inputs with Tools/textInputToBinary (see binaryInputFormat.hpp for the layout).
+ *
+ * On systems without mmap the file is read into memory once instead.
+ */
+
+#ifndef __BINARY_INPUT_STREAM_HPP__
+#define __BINARY_INPUT_STREAM_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined __unix__ || defined __APPLE__
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "binaryInputFormat.hpp"
+
+namespace cadmium::shared {
+
+    // Read-only view of a whole file, memory mapped when possible
+    class MappedInputFile {
+        const char* bytes;
+        std::size_t length;
+        std::vector<char> copy; // Used instead of the mapping when mmap is not available
+
+     public:
+        explicit MappedInputFile(const std::string& path): bytes(nullptr), length(0), copy() {
+#if defined __unix__ || defined __APPLE__
+            const int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("cannot open input file " + path);
+            }
+            struct stat info{};
+            if (fstat(fd, &info) == 0 && info.st_size > 0) {
+                void* mapping = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping != MAP_FAILED) {
+                    bytes = static_cast<const char*>(mapping);
+                    length = static_cast<std::size_t>(info.st_size);
+                }
+            }
+            close(fd);
+            if (bytes != nullptr) {
+                return;
+            }
+#endif
+            std::ifstream file(path, std::ios::binary);
+            if (!file) {
+                throw std::runtime_error("cannot open input file " + path);
+            }
+            copy.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            bytes = copy.data();
+            length = copy.size();
+        }
+
+        MappedInputFile(const MappedInputFile&) = delete;
+        MappedInputFile& operator=(const MappedInputFile&) = delete;
+
+        ~MappedInputFile() {
+#if defined __unix__ || defined __APPLE__
+            if (copy.empty() && bytes != nullptr) {
+                munmap(const_cast<char*>(bytes), length);
+            }
+#endif
+        }
+
+        [[nodiscard]] const char* data() const {
+            return bytes;
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return length;
+        }
+    };
+
+    struct BinaryInputStreamState {
+        std::size_t next; // Index of the record sent by the next output
+        double clock;     // Simulation time of the last internal transition
+        double sigma;
+
+        BinaryInputStreamState(): next(0), clock(0), sigma(std::numeric_limits<double>::infinity()) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive(next);
+            archive.timeSince(clock);
+            archive.timeLeft(sigma);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const BinaryInputStreamState& state) {
+        out << "{" << state.clock << "," << state.sigma << "}";
+        return out;
+    }
+#endif
+
+    template<typename T>
+    class BinaryInputStream : public Atomic<BinaryInputStreamState> {
+        std::shared_ptr<const MappedInputFile> file;
+        const BinaryInputRecord<T>* records;
+        std::size_t count;
+
+        [[nodiscard]] double sigmaFrom(std::size_t index, double clock) const {
+            return index < count ? records[index].time - clock : std::numeric_limits<double>::infinity();
+        }
+
+     public:
+        // Output ports
+        Port<T> out;
+
+        /**
+         * Constructor function.
+         *
+         * @param id ID of the new BinaryInputStream model object.
+         * @param filePath path of the binary input file.
+         */
+        BinaryInputStream(const std::string& id, const char* filePath):
+            Atomic<BinaryInputStreamState>(id, BinaryInputStreamState()),
+            file(std::make_shared<const MappedInputFile>(filePath)), records(nullptr), count(0) {
+            out = addOutPort<T>("out");
+
+            BinaryInputHeader header{};
+            if (file->size() < sizeof(header)) {
+                throw std::runtime_error(std::string(filePath) + " is not a binary input file");
+            }
+            std::memcpy(&header, file->data(), sizeof(header));
+            if (std::memcmp(header.magic, BINARY_INPUT_MAGIC, sizeof(header.magic)) != 0
+                || header.version != BINARY_INPUT_VERSION
+                || header.valueSize != sizeof(T) || header.recordSize != sizeof(BinaryInputRecord<T>)
+                || (file->size() - sizeof(header)) / sizeof(BinaryInputRecord<T>) < header.count) {
+                throw std::runtime_error(std::string(filePath) + " does not hold records of this value type");
+            }
+            records = reinterpret_cast<const BinaryInputRecord<T>*>(file->data() + sizeof(header));
+            count = static_cast<std::size_t>(header.count);
+            state.sigma = sigmaFrom(0, 0);
+        }
+
+        /**
+         * Moves on to the next record.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(BinaryInputStreamState& state) const override {
+            state.clock += state.sigma;
+            state.next++;
+            state.sigma = sigmaFrom(state.next, state.clock);
+        }
+
+        /**
+         * This model has no input ports, so the external transition is never triggered.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(BinaryInputStreamState& state, double e) const override {
+            state.clock += e;
+            state.sigma -= e;
+        }
+
+        /**
+         * Sends the value of the current record.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const BinaryInputStreamState& state) const override {
+            if (state.next < count) {
+                out->addMessage(records[state.next].value);
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const BinaryInputStreamState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::shared
+
+#endif // __BINARY_INPUT_STREAM_HPP__
@@ -0,0 +1,125 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Ports holding a fixed number of messages, so the embedded loop does not allocate.
+ *
+ * Cadmium keeps the messages of a port in a std::vector, which grows on the heap the
+ * first time a bag gets bigger than it ever was. Over hours of simulate(infinity),
+ * the LCD commands and LED values pushed and cleared every cycle are then the main
+ * source of heap traffic on the MSP432. A model declares its ports as
+ *
+ *     shared::BoundedPort<int, 1> out; // One floor per output
+ *
+ * and keeps initializing them with addOutPort/addInPort and using them as before
+ * (out->addMessage(), in->getBag(), addCoupling). In EMBED builds (or with
+ * STATIC_PORTS, to try it on the desktop) a BoundedPort is a FixedCapacityPort:
+ *  - the storage for Capacity messages is reserved once, when the model is built
+ *  - addMessage() drops a message that does not fit instead of growing the bag,
+ *    and counts it in overflowCount() and in portOverflowCount for all ports
+ * so the steady state loop never allocates. Otherwise it is a plain Port<T>.
+ *
+ * The capacity of an output port is the largest number of messages sent by one call
+ * to output(), plus the messages queued by the constructor (they are sent with the
+ * first output). The capacity of an input port is the sum of the capacities of the
+ * ports coupled to it; Cadmium copies the messages into input ports itself, so an
+ * input port that is too small grows instead of dropping messages.
+ */
+
+#ifndef __BOUNDED_PORT_HPP__
+#define __BOUNDED_PORT_HPP__
+
+#include <modeling/devs/port.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cadmium::shared {
+
+    // Messages dropped by all FixedCapacityPorts since reset, readable from the debugger
+    inline volatile uint32_t portOverflowCount = 0;
+
+    template<typename T, std::size_t Capacity>
+    class FixedCapacityPort {
+        static_assert(Capacity > 0, "a port must hold at least one message");
+
+        Port<T> port;
+        mutable uint32_t overflows; // Messages dropped by this port
+
+     public:
+        FixedCapacityPort(): port(), overflows(0) {}
+
+        /**
+         * Takes the port created by addOutPort/addInPort, and reserves its storage.
+         *
+         * @param created port of the model.
+         * @return this port.
+         */
+        FixedCapacityPort& operator=(const Port<T>& created) {
+            port = created;
+            // Cadmium's bag keeps its storage when cleared, so filling it once reserves the capacity
+            for (std::size_t i = 0; i < Capacity; i++) {
+                port->addMessage(T());
+            }
+            port->clear();
+            return *this;
+        }
+
+        // Gives the usual port->addMessage() / port->getBag() syntax
+        const FixedCapacityPort* operator->() const {
+            return this;
+        }
+
+        /**
+         * Adds a message to the bag, or drops it if the bag is full.
+         *
+         * @param message message to send.
+         */
+        void addMessage(const T& message) const {
+            if (port->size() >= Capacity) {
+                overflows++;
+                portOverflowCount = portOverflowCount + 1;
+                return;
+            }
+            port->addMessage(message);
+        }
+
+        [[nodiscard]] const std::vector<T>& getBag() const {
+            return port->getBag();
+        }
+
+        [[nodiscard]] bool empty() const {
+            return port->empty();
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return port->size();
+        }
+
+        [[nodiscard]] uint32_t overflowCount() const {
+            return overflows;
+        }
+
+        // Used by addCoupling
+        operator std::shared_ptr<PortInterface>() const {
+            return port;
+        }
+
+        operator const Port<T>&() const {
+            return port;
+        }
+    };
+
+#if defined EMBED || defined STATIC_PORTS
+    template<typename T, std::size_t Capacity>
+    using BoundedPort = FixedCapacityPort<T, Capacity>;
+#else
+    template<typename T, std::size_t Capacity>
+    using BoundedPort = Port<T>;
+#endif
+
+} // namespace cadmium::shared
+
+#endif // __BOUNDED_PORT_HPP__
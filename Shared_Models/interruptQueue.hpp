@@ -0,0 +1,83 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Lock-free queue passing values from one interrupt handler to the simulation loop.
+ *
+ * The interrupt handler is the only producer (push) and the model reading the queue
+ * in its transitions is the only consumer (front, pop), so the two indices are each
+ * written by one side only and no interrupt has to be disabled. The storage is part
+ * of the queue, nothing is allocated. A value pushed while the queue is full is
+ * dropped and counted in droppedCount(), the values already queued are kept.
+ */
+
+#ifndef __INTERRUPT_QUEUE_HPP__
+#define __INTERRUPT_QUEUE_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace cadmium::shared {
+
+    template<typename T, std::size_t Capacity>
+    class InterruptQueue {
+        static_assert(Capacity > 0, "a queue must hold at least one value");
+
+        T values[Capacity + 1]; // One slot stays free to tell a full queue from an empty one
+        std::atomic<std::size_t> head; // Next value to read, written by the consumer
+        std::atomic<std::size_t> tail; // Next free slot, written by the producer
+        std::atomic<uint32_t> dropped;
+
+        static constexpr std::size_t next(std::size_t index) {
+            return index == Capacity ? 0 : index + 1;
+        }
+
+     public:
+        InterruptQueue(): values(), head(0), tail(0), dropped(0) {}
+
+        /**
+         * Adds a value at the end of the queue. Called by the producer only.
+         *
+         * @param value value to add.
+         * @return false if the queue was full and the value was dropped.
+         */
+        bool push(const T& value) {
+            const std::size_t current = tail.load(std::memory_order_relaxed);
+            const std::size_t following = next(current);
+            if (following == head.load(std::memory_order_acquire)) {
+                dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+            values[current] = value;
+            tail.store(following, std::memory_order_release);
+            return true;
+        }
+
+        // Called by the consumer only
+        [[nodiscard]] bool empty() const {
+            return head.load(std::memory_order_relaxed) == tail.load(std::memory_order_acquire);
+        }
+
+        /**
+         * Gives the oldest value of the queue, which must not be empty. Called by the consumer only.
+         *
+         * @return the value pop() removes.
+         */
+        [[nodiscard]] const T& front() const {
+            return values[head.load(std::memory_order_relaxed)];
+        }
+
+        // Removes the oldest value of the queue, which must not be empty. Called by the consumer only.
+        void pop() {
+            head.store(next(head.load(std::memory_order_relaxed)), std::memory_order_release);
+        }
+
+        [[nodiscard]] uint32_t droppedCount() const {
+            return dropped.load(std::memory_order_relaxed);
+        }
+    };
+
+} // namespace cadmium::shared
+
+#endif // __INTERRUPT_QUEUE_HPP__
@@ -0,0 +1,73 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * LastEmitted<T> remembers the last value a model sent on one of its output ports,
+ * so the output function can skip messages that are identical to the previous one.
+ * Downstream models and the LCD then only see real changes, and the CSV log gets
+ * one row per change instead of one row per tick.
+ *
+ * A LastEmitted<T> lives in the model state, next to the value it tracks:
+ *  - output() calls emitIfChanged(port, state.lastX, state.x)
+ *  - internalTransition() calls state.lastX.record(state.x) before it changes
+ *    anything, since output() always runs right before it
+ *
+ * Ports that carry events rather than values (e.g. an authorization pulse that
+ * toggles the garage door every time it is received) must not be filtered.
+ *
+ * When LEGACY_POLLING is defined every message is sent again, as in the original models.
+ */
+
+#ifndef __LAST_EMITTED_HPP__
+#define __LAST_EMITTED_HPP__
+
+#include <modeling/devs/port.hpp>
+#include "passivation.hpp"
+
+namespace cadmium::shared {
+
+    template<typename T>
+    struct LastEmitted {
+        T value;
+        bool sent;
+
+        LastEmitted(): value(), sent(false) {}
+
+        /**
+         * Checks if a value would be a new message on the port.
+         *
+         * @param current value the model is about to send.
+         * @return true if nothing was sent yet or current differs from the last message.
+         */
+        [[nodiscard]] bool changed(const T& current) const {
+            return !passiveModels || !sent || !(value == current);
+        }
+
+        /**
+         * Stores the value that was sent by the last call to output().
+         *
+         * @param current value that was sent.
+         */
+        void record(const T& current) {
+            value = current;
+            sent = true;
+        }
+    };
+
+    /**
+     * Adds a message to an output port, unless it is identical to the last one sent.
+     *
+     * @param port output port of the model (a Port<T> or a BoundedPort).
+     * @param last last value sent on the port, kept in the model state.
+     * @param current value to send.
+     */
+    template<typename PortType, typename T>
+    void emitIfChanged(const PortType& port, const LastEmitted<T>& last, const T& current) {
+        if (last.changed(current)) {
+            port->addMessage(current);
+        }
+    }
+
+} // namespace cadmium::shared
+
+#endif // __LAST_EMITTED_HPP__
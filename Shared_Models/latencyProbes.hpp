@@ -0,0 +1,132 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Atomic DEVS model taking the input-to-actuator latency spans at the IO models,
+ * compiled only with LATENCY_PROBES (see Simulation/latency.hpp).
+ *
+ * A LatencyProbe is coupled to the output port of an input model (the button of the
+ * board, or the input file replaying it) or to the port feeding an output model (the
+ * LED, the buzzer), next to the models it already feeds, and never sends anything.
+ * On a given value, or on any message, it starts or stops a span, at the simulated
+ * time it keeps in its state like the observers of metricObservers.hpp. The span then
+ * records the wall time from the input being emitted to the actuator receiving its
+ * command, minus the time the models wait in between (e.g. the door closing before
+ * the elevator leaves), so only the processing of the events on the way is counted.
+ * The systems only add the probes when compiled with LATENCY_PROBES, so the models
+ * and their log are unchanged otherwise.
+ */
+
+#ifndef __LATENCY_PROBES_HPP__
+#define __LATENCY_PROBES_HPP__
+
+#ifdef LATENCY_PROBES
+
+#include <modeling/devs/atomic.hpp>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include "boundedPort.hpp"
+#include "../Simulation/latency.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::shared {
+
+    // End of the span a LatencyProbe takes
+    enum class LatencyEnd : uint8_t { Start, Stop };
+
+    struct LatencyProbeState {
+        double clock; // Simulated time of the last message
+        double sigma;
+
+        LatencyProbeState(): clock(0), sigma(std::numeric_limits<double>::infinity()) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive.timeSince(clock);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const LatencyProbeState& state) {
+        out << "Clock: " << state.clock;
+        return out;
+    }
+#endif
+
+    template<typename T>
+    class LatencyProbe : public Atomic<LatencyProbeState> {
+     public:
+        shared::BoundedPort<T, 1> in;
+
+        LatencySpan* const span; // Span started or stopped
+        const LatencyEnd end;    // Whether the probe starts or stops the span
+        const bool anyValue;     // Whether every message takes the span
+        const T value;           // Otherwise, value of in taking the span
+
+        /**
+         * Constructor function for this model.
+         *
+         * @param id ID of the new LatencyProbe model object.
+         * @param span span started or stopped by the probe.
+         * @param end whether the probe starts or stops the span.
+         * @param value value received on in that starts or stops the span, e.g. false for a button pressed.
+         */
+        LatencyProbe(const std::string& id, LatencySpan* span, LatencyEnd end, T value):
+            Atomic<LatencyProbeState>(id, LatencyProbeState()), span(span), end(end), anyValue(false), value(value) {
+            in = addInPort<T>("in");
+        }
+
+        /**
+         * Constructor function for a probe taking the span on every message.
+         *
+         * @param id ID of the new LatencyProbe model object.
+         * @param span span started or stopped by the probe.
+         * @param end whether the probe starts or stops the span.
+         */
+        LatencyProbe(const std::string& id, LatencySpan* span, LatencyEnd end):
+            Atomic<LatencyProbeState>(id, LatencyProbeState()), span(span), end(end), anyValue(true), value() {
+            in = addInPort<T>("in");
+        }
+
+        void internalTransition(LatencyProbeState& state) const override {
+            state.sigma = std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * Starts or stops the span when the value is received.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(LatencyProbeState& state, double e) const override {
+            state.clock += e;
+            for (const auto& received : in->getBag()) {
+                if (anyValue || received == value) {
+                    if (end == LatencyEnd::Start) {
+                        span->start(state.clock);
+                    } else {
+                        span->stop(state.clock);
+                    }
+                    return;
+                }
+            }
+        }
+
+        void output(const LatencyProbeState& state) const override {
+
+        }
+
+        [[nodiscard]] double timeAdvance(const LatencyProbeState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::shared
+
+#endif // LATENCY_PROBES
+
+#endif // __LATENCY_PROBES_HPP__
@@ -0,0 +1,191 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * LcdCommand is a fixed size message describing one BSP_LCD_DrawString call
+ * (column, row, text and colour). Models send it to LCDCommandOutput, which draws
+ * it without any parsing, instead of building "BSP_LCD_DrawString(...)" strings
+ * for LCDOutput. Building a command never allocates memory.
+ *
+ * The Boosterpack LCD is 128x128 pixels with 6x8 pixel characters, so a row holds
+ * at most 21 characters. Text longer than that is cut off.
+ */
+
+#ifndef __LCD_COMMAND_HPP__
+#define __LCD_COMMAND_HPP__
+
+#include <cstdint>
+#include <type_traits>
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::shared {
+
+    // Number of characters that fit on one row of the LCD screen
+    constexpr uint8_t LCD_COMMAND_TEXT_LENGTH = 21;
+
+    // RGB565 values of the colours understood by LCDOutput (same values as the BSP)
+    enum class LcdColor : uint16_t {
+        Black = 0x0000,
+        Blue = 0x001F,
+        DarkBlue = 0x34BF,
+        Red = 0xF800,
+        Green = 0x07E0,
+        LightGreen = 0x07EF,
+        Orange = 0xFD60,
+        Cyan = 0x07FF,
+        Magenta = 0xF81F,
+        Yellow = 0xFFE0,
+        White = 0xFFFF
+    };
+
+    struct LcdCommand {
+        uint8_t col;
+        uint8_t row;
+        uint8_t length; // Number of characters in text, not counting the terminating '\0'
+        LcdColor color;
+        char text[LCD_COMMAND_TEXT_LENGTH + 1];
+
+        LcdCommand(): col(0), row(0), length(0), color(LcdColor::White), text{} {}
+
+        LcdCommand(uint8_t col, uint8_t row, const char* str, LcdColor color = LcdColor::White):
+            col(col), row(row), length(0), color(color), text{} {
+            append(str);
+        }
+
+        /**
+         * Appends a string to the text of the command.
+         *
+         * @param str null terminated string to add.
+         * @return this command, so calls can be chained.
+         */
+        LcdCommand& append(const char* str) {
+            while (*str != '\0' && length < LCD_COMMAND_TEXT_LENGTH) {
+                text[length++] = *str++;
+            }
+            text[length] = '\0';
+            return *this;
+        }
+
+        /**
+         * Appends the decimal representation of an integer to the text of the command.
+         *
+         * @param value integer to add.
+         * @return this command, so calls can be chained.
+         */
+        LcdCommand& append(long value) {
+            char digits[12];
+            int n = 0;
+            unsigned long magnitude = value < 0 ? 0UL - static_cast<unsigned long>(value) : static_cast<unsigned long>(value);
+            do {
+                digits[n++] = static_cast<char>('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (value < 0) {
+                digits[n++] = '-';
+            }
+            while (n > 0 && length < LCD_COMMAND_TEXT_LENGTH) {
+                text[length++] = digits[--n];
+            }
+            text[length] = '\0';
+            return *this;
+        }
+
+        LcdCommand& append(int value) {
+            return append(static_cast<long>(value));
+        }
+
+        /**
+         * Appends a number in fixed point notation to the text of the command.
+         * With 6 decimals this matches the format of std::to_string(double).
+         *
+         * @param value number to add.
+         * @param decimals number of digits after the decimal point (at most 9).
+         * @return this command, so calls can be chained.
+         */
+        LcdCommand& append(double value, uint8_t decimals) {
+            long scale = 1;
+            for (uint8_t i = 0; i < decimals; i++) {
+                scale *= 10;
+            }
+            const bool negative = value < 0;
+            const long long scaled = static_cast<long long>((negative ? -value : value) * scale + 0.5);
+            if (negative && scaled != 0) {
+                append("-");
+            }
+            append(static_cast<long>(scaled / scale));
+            if (decimals > 0) {
+                append(".");
+                long fraction = static_cast<long>(scaled % scale);
+                for (long place = scale / 10; place > 0; place /= 10) {
+                    const char digit[2] = {static_cast<char>('0' + fraction / place), '\0'};
+                    append(digit);
+                    fraction %= place;
+                }
+            }
+            return *this;
+        }
+    };
+
+    static_assert(std::is_trivially_copyable_v<LcdCommand>, "LcdCommand must remain trivially copyable");
+
+    inline bool operator==(const LcdCommand& a, const LcdCommand& b) {
+        if (a.col != b.col || a.row != b.row || a.color != b.color || a.length != b.length) {
+            return false;
+        }
+        for (uint8_t i = 0; i < a.length; i++) {
+            if (a.text[i] != b.text[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline bool operator!=(const LcdCommand& a, const LcdCommand& b) {
+        return !(a == b);
+    }
+
+#if !defined NO_LOGGING || !defined EMBED
+    /**
+     * Returns the name LCDOutput uses for a colour (e.g. "LCD_WHITE").
+     *
+     * @param color colour to look up.
+     * @return name of the colour.
+     */
+    inline const char* lcdColorName(LcdColor color) {
+        switch (color) {
+            case LcdColor::Black: return "LCD_BLACK";
+            case LcdColor::Blue: return "LCD_BLUE";
+            case LcdColor::DarkBlue: return "LCD_DARKBLUE";
+            case LcdColor::Red: return "LCD_RED";
+            case LcdColor::Green: return "LCD_GREEN";
+            case LcdColor::LightGreen: return "LCD_LIGHTGREEN";
+            case LcdColor::Orange: return "LCD_ORANGE";
+            case LcdColor::Cyan: return "LCD_CYAN";
+            case LcdColor::Magenta: return "LCD_MAGENTA";
+            case LcdColor::Yellow: return "LCD_YELLOW";
+            case LcdColor::White: return "LCD_WHITE";
+        }
+        return "LCD_WHITE";
+    }
+
+    /**
+     * Insertion operator for LcdCommand objects. The command is printed in the same
+     * form as the strings previously sent to LCDOutput, so logs stay comparable.
+     *
+     * @param out output stream.
+     * @param command command to be represented in the output stream.
+     * @return output stream with the command already inserted.
+     */
+    inline std::ostream& operator<<(std::ostream &out, const LcdCommand& command) {
+        out << "BSP_LCD_DrawString(" << static_cast<int>(command.col) << "," << static_cast<int>(command.row) << ","
+            << command.text << "," << lcdColorName(command.color) << ")";
+        return out;
+    }
+#endif
+
+} // namespace cadmium::shared
+
+#endif // __LCD_COMMAND_HPP__
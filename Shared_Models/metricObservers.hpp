@@ -0,0 +1,252 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Atomic DEVS models measuring KPIs in simulated time, compiled only with ONLINE_METRICS
+ * (see Simulation/metrics.hpp).
+ *
+ * An observer is coupled to output ports of the models, next to the models they
+ * already feed, and never sends anything. It is passive, so the time elapsed given to
+ * each of its external transitions adds up to the simulated time, which it keeps in
+ * its state:
+ *  - IntervalObserver measures the time from a message on inStart to a given value on
+ *    inStop, e.g. from a floor request to the door opening. Requests arriving while
+ *    one is waiting belong to the same interval, and a request repeating the last one
+ *    (a model polling with LEGACY_POLLING) is not a new one.
+ *  - PhaseObserver<T, Channels> follows a phase made of the last values of Channels
+ *    ports, bit i set while port i last sent a non-zero value, e.g. the red and green
+ *    lights of a traffic light, and measures how long each phase lasts. The phase is
+ *    unknown until the first message, unless the phase the models start in is given.
+ * Each observer also keeps the start of the episode it has open, which a checkpoint
+ * saves with its state, and hands it back to its metric when the state is restored.
+ * The systems only add the observers when compiled with ONLINE_METRICS, so the models
+ * and their log are unchanged otherwise.
+ */
+
+#ifndef __METRIC_OBSERVERS_HPP__
+#define __METRIC_OBSERVERS_HPP__
+
+#ifdef ONLINE_METRICS
+
+#include <modeling/devs/atomic.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include "boundedPort.hpp"
+#include "../Simulation/metrics.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::shared {
+
+    template<typename Start>
+    struct IntervalObserverState {
+        double clock;          // Simulated time of the last message
+        Start lastStart;       // Last value received on inStart
+        bool started;          // Whether a value was received on inStart yet
+        double openedAt;       // Start of the interval waiting for inStop, negative if none
+        MetricSummary* metric; // Metric receiving the intervals, not saved
+        double sigma;
+
+        explicit IntervalObserverState(MetricSummary* metric = nullptr):
+            clock(0), lastStart(), started(false), openedAt(-1), metric(metric), sigma(std::numeric_limits<double>::infinity()) {}
+
+        // The interval waiting is reopened in the metric when the state is restored
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive.timeSince(clock);
+            archive(lastStart, started, openedAt);
+            if constexpr (Archive::loading) {
+                if (metric != nullptr) {
+                    metric->resume(openedAt);
+                }
+            }
+        }
+    };
+
+    struct PhaseObserverState {
+        double clock;                  // Simulated time of the last message
+        uint8_t phase;                 // Phase seen last
+        bool seen;                     // Whether the phase is known yet
+        double openedAt;               // Start of the phase seen last
+        MetricSummary* const* metrics; // Metric of each phase, nullptr if the phase is not measured; not saved
+        std::size_t phaseCount;        // Number of phases in metrics
+        double sigma;
+
+        PhaseObserverState(): clock(0), phase(0), seen(false), openedAt(0), metrics(nullptr), phaseCount(0),
+                              sigma(std::numeric_limits<double>::infinity()) {}
+
+        // The phase seen is reopened in its metric when the state is restored
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive.timeSince(clock);
+            archive(phase, seen, openedAt);
+            if constexpr (Archive::loading) {
+                for (std::size_t i = 0; i < phaseCount; i++) {
+                    if (metrics[i] != nullptr) {
+                        metrics[i]->resume(seen && i == phase ? openedAt : -1);
+                    }
+                }
+            }
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    template<typename Start>
+    std::ostream& operator<<(std::ostream &out, const IntervalObserverState<Start>& state) {
+        out << "Clock: " << state.clock << ",LastStart: " << state.lastStart;
+        return out;
+    }
+
+    std::ostream& operator<<(std::ostream &out, const PhaseObserverState& state) {
+        out << "Clock: " << state.clock << ",Phase: " << static_cast<int>(state.phase);
+        return out;
+    }
+#endif
+
+    template<typename Start, typename Stop>
+    class IntervalObserver : public Atomic<IntervalObserverState<Start>> {
+     public:
+        shared::BoundedPort<Start, 1> inStart;
+        shared::BoundedPort<Stop, 1> inStop;
+
+        MetricSummary* const metric; // Intervals measured
+        const Stop stopValue;        // Value of inStop ending the interval
+
+        /**
+         * Constructor function for this model.
+         *
+         * @param id ID of the new IntervalObserver model object.
+         * @param metric metric receiving the intervals.
+         * @param stopValue value received on inStop that ends the interval.
+         */
+        IntervalObserver(const std::string& id, MetricSummary* metric, Stop stopValue):
+            Atomic<IntervalObserverState<Start>>(id, IntervalObserverState<Start>(metric)), metric(metric), stopValue(stopValue) {
+            inStart = this->template addInPort<Start>("inStart");
+            inStop = this->template addInPort<Stop>("inStop");
+        }
+
+        void internalTransition(IntervalObserverState<Start>& state) const override {
+            state.sigma = std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * Ends the interval waiting on a stop value, then starts one on a start message.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(IntervalObserverState<Start>& state, double e) const override {
+            state.clock += e;
+            for (const auto& value : inStop->getBag()) {
+                if (value == stopValue) {
+                    metric->close(state.clock);
+                    state.openedAt = -1;
+                }
+            }
+            bool requested = false;
+            for (const auto& value : inStart->getBag()) {
+                requested = requested || !state.started || !(value == state.lastStart);
+                state.lastStart = value;
+                state.started = true;
+            }
+            if (requested && state.openedAt < 0) {
+                metric->open(state.clock);
+                state.openedAt = state.clock;
+            }
+        }
+
+        void output(const IntervalObserverState<Start>& state) const override {
+
+        }
+
+        [[nodiscard]] double timeAdvance(const IntervalObserverState<Start>& state) const override {
+            return state.sigma;
+        }
+    };
+
+    template<typename T, std::size_t Channels>
+    class PhaseObserver : public Atomic<PhaseObserverState> {
+        static_assert(Channels > 0 && Channels <= 8, "the phase of a PhaseObserver is kept in 8 bits");
+
+     public:
+        static constexpr std::size_t PHASES = std::size_t(1) << Channels;
+
+        shared::BoundedPort<T, 1> in[Channels];
+
+        const std::array<MetricSummary*, PHASES> phases; // Metric of each phase, nullptr if the phase is not measured
+
+        /**
+         * Constructor function for this model.
+         *
+         * @param id ID of the new PhaseObserver model object.
+         * @param phases metric receiving the durations of each phase, indexed by the bits of the phase.
+         * @param initialPhase phase at the start of the simulation, or -1 if it is unknown until the first message.
+         */
+        PhaseObserver(const std::string& id, const std::array<MetricSummary*, PHASES>& phases, int initialPhase = -1):
+            Atomic<PhaseObserverState>(id, PhaseObserverState()), phases(phases) {
+            state.metrics = this->phases.data();
+            state.phaseCount = PHASES;
+            for (std::size_t i = 0; i < Channels; i++) {
+                in[i] = addInPort<T>("in" + std::to_string(i));
+            }
+            if (initialPhase >= 0 && static_cast<std::size_t>(initialPhase) < PHASES) {
+                state.phase = static_cast<uint8_t>(initialPhase);
+                state.seen = true;
+                if (phases[state.phase] != nullptr) {
+                    phases[state.phase]->open(0);
+                }
+            }
+        }
+
+        void internalTransition(PhaseObserverState& state) const override {
+            state.sigma = std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * Updates the phase from the last value of each port, and measures the phase left.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(PhaseObserverState& state, double e) const override {
+            state.clock += e;
+            uint8_t phase = state.phase;
+            for (std::size_t i = 0; i < Channels; i++) {
+                for (const auto& value : in[i]->getBag()) {
+                    phase = static_cast<uint8_t>(value != T() ? (phase | (1u << i)) : (phase & ~(1u << i)));
+                }
+            }
+            if (state.seen && phase == state.phase) {
+                return;
+            }
+            if (state.seen && phases[state.phase] != nullptr) {
+                phases[state.phase]->close(state.clock);
+            }
+            if (phases[phase] != nullptr) {
+                phases[phase]->open(state.clock);
+            }
+            state.openedAt = state.clock;
+            state.phase = phase;
+            state.seen = true;
+        }
+
+        void output(const PhaseObserverState& state) const override {
+
+        }
+
+        [[nodiscard]] double timeAdvance(const PhaseObserverState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::shared
+
+#endif // ONLINE_METRICS
+
+#endif // __METRIC_OBSERVERS_HPP__
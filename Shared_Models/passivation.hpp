@@ -0,0 +1,42 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Helpers shared by the example controller models for switching between
+ * event-driven (passive) scheduling and the original fixed-period polling.
+ *
+ * In passive mode a model only schedules an internal transition when its state
+ * changed in a way that has to be reported on an output port; otherwise its time
+ * advance is infinity and it sleeps until the next input arrives.
+ *
+ * Compile with -DLEGACY_POLLING to bring back the original behaviour, where every
+ * model re-runs output/internalTransition on its poll period whether or not anything
+ * changed. This is mostly useful for diffing CSV traces against older runs.
+ */
+
+#ifndef __PASSIVATION_HPP__
+#define __PASSIVATION_HPP__
+
+#include <limits>
+
+namespace cadmium::shared {
+
+#ifdef LEGACY_POLLING
+    constexpr bool passiveModels = false;
+#else
+    constexpr bool passiveModels = true;
+#endif
+
+    /**
+     * Returns the sigma a model should use once it has nothing left to report.
+     *
+     * @param period poll period of the model, used when LEGACY_POLLING is defined.
+     * @return infinity in passive mode, otherwise the poll period.
+     */
+    constexpr double idleSigma(double period) {
+        return passiveModels ? std::numeric_limits<double>::infinity() : period;
+    }
+
+} // namespace cadmium::shared
+
+#endif // __PASSIVATION_HPP__
@@ -0,0 +1,109 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * ProbeReporter prints the reports of the probes every period seconds: the latency
+ * histograms with LATENCY_PROBES (see Simulation/latency.hpp), the profile of
+ * the models with PROFILE_TRANSITIONS (see Simulation/transitionProfiler.hpp) and
+ * the metrics with ONLINE_METRICS (see Simulation/metrics.hpp).
+ * The embedded simulations never end, so the systems add it to report over the
+ * UART when compiled with EMBED and any of these flags; the desktop builds print
+ * the reports once the simulation stopped instead.
+ *
+ * The model has no ports. Printing takes a few milliseconds at 115200 baud, which
+ * delays the events that are due meanwhile, so keep the period long.
+ */
+
+#ifndef __PROBE_REPORTER_HPP__
+#define __PROBE_REPORTER_HPP__
+
+#include <modeling/devs/atomic.hpp>
+
+#include "../Simulation/latency.hpp"
+#include "../Simulation/transitionProfiler.hpp"
+#include "../Simulation/metrics.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::shared {
+
+    struct ProbeReporterState {
+        unsigned long reports; // Reports printed so far
+        double sigma;
+
+        explicit ProbeReporterState(double period): reports(0), sigma(period) {}
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const ProbeReporterState& state) {
+        out << "Reports: " << state.reports;
+        return out;
+    }
+#endif
+
+    class ProbeReporter : public Atomic<ProbeReporterState> {
+     public:
+        const double period; // Time between two reports
+
+        /**
+         * Constructor function for this model.
+         *
+         * @param id ID of the new ProbeReporter model object.
+         * @param period time in seconds between two reports.
+         */
+        ProbeReporter(const std::string& id, double period = 30.0):
+            Atomic<ProbeReporterState>(id, ProbeReporterState(period)), period(period) {}
+
+        /**
+         * The reports have just been printed, the next ones are due in period seconds.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(ProbeReporterState& state) const override {
+            state.reports++;
+            state.sigma = period;
+        }
+
+        /**
+         * This model has no input ports, so the external transition is never triggered.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(ProbeReporterState& state, double e) const override {
+
+        }
+
+        /**
+         * Prints the reports. Nothing is sent, the model has no output port.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const ProbeReporterState& state) const override {
+#ifdef LATENCY_PROBES
+            printLatencyReport();
+#endif
+#ifdef PROFILE_TRANSITIONS
+            printTransitionProfile();
+#endif
+#ifdef ONLINE_METRICS
+            // The reports are printed every period, from the start of the simulation
+            printMetricsReport(period * static_cast<double>(state.reports + 1));
+#endif
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const ProbeReporterState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::shared
+
+#endif // __PROBE_REPORTER_HPP__
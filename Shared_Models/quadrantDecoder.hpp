@@ -0,0 +1,72 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Table-driven decoder turning a joystick position into a key code, shared by the
+ * models that read a number from the joystick (GarageLock, ElevatorNum).
+ *
+ * Each axis is first quantized into zones by AxisZones, using thresholds fixed at
+ * compile time: a value falls in zone n when it is at or above exactly n of the
+ * thresholds. The pair of zones then indexes a mapping table giving the code of
+ * that position, 0 meaning no key. Decoding is two comparisons per threshold and
+ * one table read, with no branch chain, and everything is constexpr, so each
+ * model can check its mapping against its diagram with static_assert.
+ *
+ * More zones only need more thresholds and a bigger table, e.g. a 9-zone keypad:
+ *     using KeypadAxis = AxisZones<300, 700>;                   // 3 zones per axis
+ *     constexpr QuadrantDecoder<KeypadAxis, KeypadAxis> keypad{{{7, 8, 9}, {4, 5, 6}, {1, 2, 3}}};
+ */
+
+#ifndef __QUADRANT_DECODER_HPP__
+#define __QUADRANT_DECODER_HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cadmium::shared {
+
+    template<int... Thresholds>
+    struct AxisZones {
+        static constexpr std::size_t count = sizeof...(Thresholds) + 1;
+
+        /**
+         * Quantizes a joystick value.
+         *
+         * @param value ADC value of the axis.
+         * @return zone of the value, from 0 (below every threshold) to count - 1.
+         */
+        static constexpr std::size_t zone(int value) {
+            return (static_cast<std::size_t>(value >= Thresholds) + ... + 0);
+        }
+    };
+
+    // Zones used by the Boosterpack joystick models: low below 400, centre up to 600, high above 600
+    using JoystickAxisZones = AxisZones<400, 601>;
+
+    template<typename XZones, typename YZones>
+    struct QuadrantDecoder {
+        // Code of every position, indexed by [y zone][x zone], 0 meaning no key
+        uint8_t table[YZones::count][XZones::count];
+
+        /**
+         * Decodes a joystick position.
+         *
+         * @param x ADC value of the X axis.
+         * @param y ADC value of the Y axis.
+         * @return the code of the position, or 0 if it does not select a key.
+         */
+        [[nodiscard]] constexpr uint8_t decode(int x, int y) const {
+            return table[YZones::zone(y)][XZones::zone(x)];
+        }
+    };
+
+    // Decoder for the four corners of the joystick, which are used by the example systems
+    using JoystickQuadrants = QuadrantDecoder<JoystickAxisZones, JoystickAxisZones>;
+
+    static_assert(JoystickAxisZones::zone(399) == 0 && JoystickAxisZones::zone(400) == 1
+                  && JoystickAxisZones::zone(600) == 1 && JoystickAxisZones::zone(601) == 2,
+                  "Joystick zones must match the original < 400 and > 600 comparisons");
+
+} // namespace cadmium::shared
+
+#endif // __QUADRANT_DECODER_HPP__
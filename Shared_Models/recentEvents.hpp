@@ -0,0 +1,127 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * RecentEvents<N> keeps the last N short event tokens (e.g. "1 ", "DC ", "IN:3")
+ * that a model records for its log. It replaces std::string fields that were
+ * appended to on every input and never cleared. Its size is fixed, so the state
+ * does not grow over long runs, and copying it never allocates.
+ *
+ * Printing it writes the stored tokens oldest first with nothing in between, the
+ * same way the appended string used to print (limited to the last N tokens).
+ *
+ * These fields are only used for logging. Models declare them inside
+ * #if !defined NO_LOGGING || !defined EMBED and update them with RECORD_EVENT, so
+ * the fields and every update are removed completely from embedded builds without
+ * logging.
+ */
+
+#ifndef __RECENT_EVENTS_HPP__
+#define __RECENT_EVENTS_HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::shared {
+
+    template<std::size_t N, std::size_t TokenLength = 7>
+    class RecentEvents {
+        static_assert(N > 0 && N < 256, "RecentEvents holds between 1 and 255 tokens");
+
+        char tokens[N][TokenLength + 1];
+        uint8_t next;  // Slot the next token is written to
+        uint8_t count; // Number of slots in use
+
+     public:
+        RecentEvents(): tokens{}, next(0), count(0) {}
+
+        /**
+         * Records a token, dropping the oldest one when the buffer is full.
+         * Tokens longer than TokenLength characters are cut off.
+         *
+         * @param token null terminated text of the event.
+         */
+        void push(const char* token) {
+            std::size_t i = 0;
+            for (; token[i] != '\0' && i < TokenLength; i++) {
+                tokens[next][i] = token[i];
+            }
+            tokens[next][i] = '\0';
+            next = static_cast<uint8_t>((next + 1) % N);
+            if (count < N) {
+                count++;
+            }
+        }
+
+        /**
+         * Records a token made of a prefix followed by a number and a suffix (e.g. "IN:" and 3).
+         *
+         * @param prefix null terminated text placed before the number.
+         * @param value number placed after the prefix.
+         * @param suffix null terminated text placed after the number.
+         */
+        void push(const char* prefix, int value, const char* suffix = "") {
+            char token[TokenLength + 1];
+            std::size_t length = 0;
+            for (; prefix[length] != '\0' && length < TokenLength; length++) {
+                token[length] = prefix[length];
+            }
+            char digits[12];
+            int n = 0;
+            unsigned int magnitude = value < 0 ? 0U - static_cast<unsigned int>(value) : static_cast<unsigned int>(value);
+            do {
+                digits[n++] = static_cast<char>('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (value < 0) {
+                digits[n++] = '-';
+            }
+            while (n > 0 && length < TokenLength) {
+                token[length++] = digits[--n];
+            }
+            for (std::size_t i = 0; suffix[i] != '\0' && length < TokenLength; i++) {
+                token[length++] = suffix[i];
+            }
+            token[length] = '\0';
+            push(token);
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return count;
+        }
+
+        /**
+         * Returns a stored token.
+         *
+         * @param i index of the token, 0 being the oldest one still stored.
+         * @return null terminated text of the token.
+         */
+        [[nodiscard]] const char* operator[](std::size_t i) const {
+            return tokens[(next + N - count + i) % N];
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    template<std::size_t N, std::size_t TokenLength>
+    std::ostream& operator<<(std::ostream &out, const RecentEvents<N, TokenLength>& events) {
+        for (std::size_t i = 0; i < events.size(); i++) {
+            out << events[i];
+        }
+        return out;
+    }
+#endif
+
+} // namespace cadmium::shared
+
+// Records an event in a RecentEvents field, or does nothing when the field is compiled out
+#if !defined NO_LOGGING || !defined EMBED
+    #define RECORD_EVENT(events, ...) (events).push(__VA_ARGS__)
+#else
+    #define RECORD_EVENT(events, ...) ((void)0)
+#endif
+
+#endif // __RECENT_EVENTS_HPP__
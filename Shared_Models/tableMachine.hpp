@@ -0,0 +1,152 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Finite state machines described by a constexpr table, run by the atomic models.
+ *
+ * A MachineTable gives, for each state of the machine:
+ *  - the index of the time spent in the state, in an array of durations given by the
+ *    model (so they can be constants or constructor parameters), and the state
+ *    entered once that time elapsed
+ *  - its bool outputs, packed in one byte (bit i for output i)
+ *  - the state entered on each input event, or MACHINE_STAY when the event is ignored
+ * The model keeps a MachineRun in its state and maps its DEVS functions onto the table:
+ *  - internalTransition(): sigma = table.timeout(state.machine, durations)
+ *  - externalTransition(): works out which event each input is, then
+ *    table.react(state.machine, event, state.sigma, durations)
+ *  - output(): sends output i when bit i of table.changedOutputs(state.machine) is set,
+ *    with the value table.output(state.machine, i)
+ *  - timeAdvance(): state.sigma
+ * Every step is a lookup in the table, with no branch on the state of the machine.
+ * As with LastEmitted, the outputs are those of the state being left, and only the
+ * outputs that changed since the last call to output() are sent (all of them when
+ * LEGACY_POLLING is defined).
+ *
+ * The table is checked at compile time next to its definition:
+ *     static_assert(trafficLightTable.valid(), "...");
+ */
+
+#ifndef __TABLE_MACHINE_HPP__
+#define __TABLE_MACHINE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include "passivation.hpp"
+
+namespace cadmium::shared {
+
+    // Target of an event ignored in a state: the machine keeps its state and its time left
+    constexpr uint8_t MACHINE_STAY = 0xFF;
+
+    template<std::size_t Events>
+    struct MachineRow {
+        uint8_t duration;   // Index of the time spent in the state, in the durations of the model
+        uint8_t timeout;    // State entered once that time elapsed
+        uint8_t outputs;    // Outputs of the state, bit i for output i
+        uint8_t on[Events]; // State entered on each input event, or MACHINE_STAY
+    };
+
+    // Where a machine is, kept in the state of the model running it
+    struct MachineRun {
+        uint8_t current;     // State of the machine, a row of its table
+        uint8_t lastOutputs; // Outputs sent by the last call to output()
+        bool sent;           // Whether any output was sent yet
+
+        MachineRun(): current(0), lastOutputs(0), sent(false) {}
+        explicit MachineRun(uint8_t initial): current(initial), lastOutputs(0), sent(false) {}
+    };
+
+    template<std::size_t States, std::size_t Events, std::size_t Durations>
+    struct MachineTable {
+        MachineRow<Events> rows[States];
+
+        /**
+         * Checks that every target is a state of the table and every duration one of the model.
+         *
+         * @return true if the table can be run.
+         */
+        [[nodiscard]] constexpr bool valid() const {
+            for (std::size_t state = 0; state < States; state++) {
+                const MachineRow<Events>& row = rows[state];
+                if (row.duration >= Durations || row.timeout >= States) {
+                    return false;
+                }
+                for (std::size_t event = 0; event < Events; event++) {
+                    if (row.on[event] != MACHINE_STAY && row.on[event] >= States) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Gives the time spent in a state.
+         *
+         * @param state state of the table.
+         * @param durations durations of the model, indexed by the rows.
+         * @return the time between entering the state and its timeout.
+         */
+        [[nodiscard]] double duration(uint8_t state, const double (&durations)[Durations]) const {
+            return durations[rows[state].duration];
+        }
+
+        /**
+         * Applies the timeout of the current state, once its outputs were sent.
+         *
+         * @param run machine to update.
+         * @param durations durations of the model, indexed by the rows.
+         * @return the time spent in the state entered.
+         */
+        double timeout(MachineRun& run, const double (&durations)[Durations]) const {
+            run.lastOutputs = rows[run.current].outputs;
+            run.sent = true;
+            run.current = rows[run.current].timeout;
+            return durations[rows[run.current].duration];
+        }
+
+        /**
+         * Applies an input event.
+         *
+         * @param run machine to update.
+         * @param event input event, between 0 and Events - 1.
+         * @param sigma time left in the current state, set to the time spent in the state entered.
+         * @param durations durations of the model, indexed by the rows.
+         * @return true if a state was entered, false if the event is ignored in the current state.
+         */
+        bool react(MachineRun& run, uint8_t event, double& sigma, const double (&durations)[Durations]) const {
+            const uint8_t next = rows[run.current].on[event];
+            if (next == MACHINE_STAY) {
+                return false;
+            }
+            run.current = next;
+            sigma = durations[rows[next].duration];
+            return true;
+        }
+
+        /**
+         * Gives the outputs to send from the current state.
+         *
+         * @param run machine about to leave its state.
+         * @return bit i set if output i changed since the last call to output(), or was never sent.
+         */
+        [[nodiscard]] uint8_t changedOutputs(const MachineRun& run) const {
+            const bool all = !passiveModels || !run.sent;
+            return all ? 0xFF : static_cast<uint8_t>(rows[run.current].outputs ^ run.lastOutputs);
+        }
+
+        /**
+         * Gives the value of an output in the current state.
+         *
+         * @param run machine.
+         * @param output index of the output, below 8.
+         * @return the bit of the output in the current state.
+         */
+        [[nodiscard]] bool output(const MachineRun& run, std::size_t output) const {
+            return (rows[run.current].outputs >> output) & 1u;
+        }
+    };
+
+} // namespace cadmium::shared
+
+#endif // __TABLE_MACHINE_HPP__
@@ -0,0 +1,314 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * TemperatureConditioner turns the samples of TemperatureSensorInput into a filtered
+ * temperature and a threshold level, in integer arithmetic, for the Temperature and
+ * GarageDoorOpener examples.
+ *
+ * The sensor sends degrees Celsius times 100000. Each sample is converted once to
+ * hundredths of a degree (CentiCelsius); everything after that is 32-bit integer
+ * arithmetic, so the MSP432 never calls the soft-float double routines (its FPU is
+ * single precision only):
+ *  - the filter smooths the samples: none, a moving average of the last window
+ *    samples, or an exponential average adding 1/2^shift of each new difference
+ *  - thresholds split the filtered temperature into levels: the level is the number
+ *    of thresholds the temperature is above. A threshold is crossed upwards at
+ *    rising and downwards below falling, so noise around it does not toggle the level
+ *  - out sends the filtered temperature when it moved by at least delta since it
+ *    was last sent, or when the level changed; outLevel sends the level when it
+ *    changed; lcdTemperature shows the temperature sent on out
+ * Models reacting to a threshold (TemperatureSignal, GarageLock) read outLevel, so
+ * they only run when the level changes.
+ */
+
+#ifndef __TEMPERATURE_CONDITIONER_HPP__
+#define __TEMPERATURE_CONDITIONER_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "passivation.hpp"
+#include "lastEmitted.hpp"
+#include "lcdCommand.hpp"
+#include "boundedPort.hpp"
+
+#if !defined NO_LOGGING || !defined EMBED
+    #include <iostream>
+#endif
+
+namespace cadmium::shared {
+
+    // Temperature in hundredths of a degree Celsius
+    using CentiCelsius = int32_t;
+
+    // Units of TemperatureSensorInput (1/100000 degree) in one CentiCelsius, and in one degree
+    constexpr int32_t SENSOR_UNITS_PER_CENTI_CELSIUS = 1000;
+    constexpr int32_t SENSOR_UNITS_PER_CELSIUS = 100 * SENSOR_UNITS_PER_CENTI_CELSIUS;
+
+    constexpr std::size_t MAX_TEMPERATURE_WINDOW = 16;
+    constexpr std::size_t MAX_TEMPERATURE_THRESHOLDS = 4;
+
+    enum class TemperatureFilter : uint8_t {
+        None,
+        MovingAverage, // Mean of the last window samples
+        Exponential    // Adds 1/2^shift of the difference between each sample and the filtered temperature
+    };
+
+    struct TemperatureThreshold {
+        CentiCelsius rising;  // The temperature is above the threshold from this value
+        CentiCelsius falling; // and below it again under this value (at most rising)
+    };
+
+    struct TemperatureConditionerConfig {
+        TemperatureFilter filter = TemperatureFilter::None;
+        uint8_t window = 4;       // Samples averaged with TemperatureFilter::MovingAverage (1 to MAX_TEMPERATURE_WINDOW)
+        uint8_t shift = 2;        // Weight 1/2^shift of a new sample with TemperatureFilter::Exponential (at most 15),
+                                  // which leaves the filtered temperature up to 2^shift - 1 hundredths from a steady sample
+        CentiCelsius delta = 1;   // Smallest change of the filtered temperature sent on out
+        std::array<TemperatureThreshold, MAX_TEMPERATURE_THRESHOLDS> thresholds{}; // Sorted by rising temperature
+        uint8_t thresholdCount = 0;
+        double pollPeriod = 1.0;  // Delay before a new temperature is sent out
+        uint8_t lcdCol = 0;       // Position of the temperature on the LCD
+        uint8_t lcdRow = 0;
+        const char* lcdTitle = nullptr; // Drawn on row 0 at startup, if any
+
+        /**
+         * Adds a threshold, above the ones already added.
+         *
+         * @param rising temperature from which the level goes up.
+         * @param falling temperature under which the level goes down again.
+         * @return this configuration, so calls can be chained.
+         */
+        TemperatureConditionerConfig& addThreshold(CentiCelsius rising, CentiCelsius falling) {
+            if (thresholdCount < MAX_TEMPERATURE_THRESHOLDS) {
+                thresholds[thresholdCount++] = {rising, falling < rising ? falling : rising};
+            }
+            return *this;
+        }
+    };
+
+    /**
+     * Appends a temperature to an LCD command, with two decimals.
+     *
+     * @param command command to which the temperature is added.
+     * @param temperature temperature to add.
+     * @return the command, so calls can be chained.
+     */
+    inline LcdCommand& appendCentiCelsius(LcdCommand& command, CentiCelsius temperature) {
+        const CentiCelsius magnitude = temperature < 0 ? -temperature : temperature;
+        if (temperature < 0) {
+            command.append("-");
+        }
+        command.append(static_cast<long>(magnitude / 100)).append(".");
+        const char hundredths[3] = {static_cast<char>('0' + magnitude % 100 / 10), static_cast<char>('0' + magnitude % 10), '\0'};
+        return command.append(hundredths);
+    }
+
+    struct TemperatureConditionerState {
+        double sigma;
+
+        // Filter
+        std::array<CentiCelsius, MAX_TEMPERATURE_WINDOW> samples; // Last samples, for TemperatureFilter::MovingAverage
+        int32_t sampleSum;   // Sum of the samples in the window
+        uint8_t sampleCount; // Samples received, up to the window
+        uint8_t nextSample;  // Slot of the next sample in samples
+        CentiCelsius temperature; // Filtered temperature
+        uint8_t level;            // Number of thresholds the temperature is above
+
+        shared::LcdCommand textTemperature;
+
+        //Last values sent on the output ports, used to skip repeated messages
+        shared::LastEmitted<CentiCelsius> lastTemperature;
+        shared::LastEmitted<uint8_t> lastLevel;
+        shared::LastEmitted<shared::LcdCommand> lastTextTemperature;
+
+        TemperatureConditionerState(): sigma(0), samples{}, sampleSum(0), sampleCount(0), nextSample(0),
+                                       temperature(0), level(0) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive.timeLeft(sigma);
+            archive(samples, sampleSum, sampleCount, nextSample, temperature, level);
+            archive(textTemperature, lastTemperature, lastLevel, lastTextTemperature);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const TemperatureConditionerState& state) {
+        LcdCommand temperature;
+        appendCentiCelsius(temperature, state.temperature);
+        out << ", Temperature: " << temperature.text << ", Level: " << static_cast<int>(state.level);
+        return out;
+    }
+#endif
+
+    class TemperatureConditioner : public Atomic<TemperatureConditionerState> {
+
+        // Brings the window, shift and delta of a configuration within their ranges
+        static TemperatureConditionerConfig clamped(TemperatureConditionerConfig config) {
+            config.window = config.window == 0 ? 1 : (config.window > MAX_TEMPERATURE_WINDOW ? MAX_TEMPERATURE_WINDOW : config.window);
+            config.shift = config.shift > 15 ? 15 : config.shift;
+            config.delta = config.delta < 1 ? 1 : config.delta;
+            return config;
+        }
+
+        /**
+         * Adds a sample to the filter.
+         *
+         * @param state reference to the current model state.
+         * @param sample new temperature read by the sensor.
+         * @return the filtered temperature.
+         */
+        CentiCelsius filterSample(TemperatureConditionerState& state, CentiCelsius sample) const {
+            switch (config.filter) {
+                case TemperatureFilter::MovingAverage: {
+                    const uint8_t window = config.window;
+                    if (state.sampleCount == window) {
+                        state.sampleSum -= state.samples[state.nextSample];
+                    } else {
+                        state.sampleCount++;
+                    }
+                    state.samples[state.nextSample] = sample;
+                    state.sampleSum += sample;
+                    state.nextSample = static_cast<uint8_t>((state.nextSample + 1) % window);
+                    return state.sampleSum / state.sampleCount;
+                }
+                case TemperatureFilter::Exponential:
+                    if (state.sampleCount == 0) {
+                        state.sampleCount = 1;
+                        return sample;
+                    }
+                    return state.temperature + (sample - state.temperature) / (int32_t{1} << config.shift);
+                default:
+                    state.sampleCount = 1;
+                    return sample;
+            }
+        }
+
+        /**
+         * Moves the level across the thresholds the temperature crossed.
+         *
+         * @param level current level.
+         * @param temperature filtered temperature.
+         * @return the new level.
+         */
+        [[nodiscard]] uint8_t levelOf(uint8_t level, CentiCelsius temperature) const {
+            while (level < config.thresholdCount && temperature >= config.thresholds[level].rising) {
+                level++;
+            }
+            while (level > 0 && temperature < config.thresholds[level - 1].falling) {
+                level--;
+            }
+            return level;
+        }
+
+     public:
+
+        // Input ports
+        shared::BoundedPort<double, 1> inTemperature; // Degrees Celsius times 100000, from TemperatureSensorInput
+
+        // Output ports
+        shared::BoundedPort<CentiCelsius, 1> out;
+        shared::BoundedPort<uint8_t, 1> outLevel;
+        shared::BoundedPort<shared::LcdCommand, 2> lcdTemperature; // The title queued by the constructor, then one per output
+
+        const TemperatureConditionerConfig config;
+
+        /**
+         * Constructor function for this atomic model.
+         *
+         * @param id ID of the new TemperatureConditioner model object.
+         * @param config filter, thresholds and display of the temperature.
+         */
+        TemperatureConditioner(const std::string& id, const TemperatureConditionerConfig& config):
+            Atomic<TemperatureConditionerState>(id, TemperatureConditionerState()), config(clamped(config)) {
+
+            inTemperature = addInPort<double>("inTemperature");
+
+            out = addOutPort<CentiCelsius>("out");
+            outLevel = addOutPort<uint8_t>("outLevel");
+            lcdTemperature = addOutPort<shared::LcdCommand>("lcdTemperature");
+
+            // Nothing is sent until the first sample, except the title
+            state.sigma = shared::idleSigma(config.pollPeriod);
+            if (config.lcdTitle != nullptr) {
+                lcdTemperature->addMessage(shared::LcdCommand(0, 0, config.lcdTitle));
+                state.sigma = config.pollPeriod;
+            }
+            state.lastTextTemperature.record(state.textTemperature);
+        }
+
+        /**
+         * The transition function is invoked each time the value of
+         * state.sigma reaches 0.
+         *
+         * The temperature and level have just been sent, so the model goes passive
+         * until a sample changes them enough (or keeps polling when LEGACY_POLLING
+         * is defined).
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(TemperatureConditionerState& state) const override {
+            if (state.sampleCount != 0) {
+                state.lastTemperature.record(state.temperature);
+                state.lastLevel.record(state.level);
+            }
+            state.lastTextTemperature.record(state.textTemperature);
+            state.sigma = shared::idleSigma(config.pollPeriod);
+        }
+
+        /**
+         * Filters the samples received, and schedules an output when the level changed
+         * or the temperature moved by delta since it was last sent. An output already
+         * scheduled is kept, and sends the temperature filtered by then, so samples
+         * arriving faster than pollPeriod do not keep pushing it back.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(TemperatureConditionerState& state, double e) const override {
+            state.sigma -= e;
+            for (const auto i : inTemperature->getBag()) {
+                const CentiCelsius sample = static_cast<int32_t>(i) / SENSOR_UNITS_PER_CENTI_CELSIUS;
+                state.temperature = filterSample(state, sample);
+                state.level = levelOf(state.level, state.temperature);
+            }
+
+            const CentiCelsius sent = state.lastTemperature.sent ? state.lastTemperature.value : state.temperature;
+            const CentiCelsius moved = state.temperature > sent ? state.temperature - sent : sent - state.temperature;
+            if (!state.lastTemperature.sent || state.lastLevel.changed(state.level) || moved >= config.delta) {
+                state.textTemperature = shared::LcdCommand(config.lcdCol, config.lcdRow, " Temp: ");
+                appendCentiCelsius(state.textTemperature, state.temperature).append(" *C");
+                state.sigma = state.sigma < config.pollPeriod ? state.sigma : config.pollPeriod;
+            }
+        }
+
+        /**
+         * Sends the filtered temperature, its level and its text, if they changed.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const TemperatureConditionerState& state) const override {
+            if (state.sampleCount != 0) {
+                shared::emitIfChanged(out, state.lastTemperature, state.temperature);
+                shared::emitIfChanged(outLevel, state.lastLevel, state.level);
+            }
+            shared::emitIfChanged(lcdTemperature, state.lastTextTemperature, state.textTemperature);
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const TemperatureConditionerState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::shared
+
+#endif // __TEMPERATURE_CONDITIONER_HPP__
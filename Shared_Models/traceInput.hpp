@@ -0,0 +1,204 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * TraceInput plays back a single recorded trace of the Boosterpack inputs used
+ * by the desktop builds, in place of one IEStream per input. Every line of the
+ * trace has the form
+ *
+ *     time channel value
+ *
+ * where channel is button, submit, x or y, and the lines are sorted by time.
+ * All the lines sharing a timestamp are sent in the same output, each on the port
+ * of its channel, so the receiving model handles them in one external transition
+ * (as with JoystickInput, which sends X and Y together on the embedded side).
+ * Ports of channels that are not in the trace are simply never used.
+ *
+ * The trace is read once when the model is created. Tools/mergeTextInputs builds
+ * a trace from the separate IEStream text files.
+ */
+
+#ifndef __TRACE_INPUT_HPP__
+#define __TRACE_INPUT_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cadmium::shared {
+
+    enum class TraceChannel : uint8_t {
+        Button,
+        Submit,
+        X,
+        Y
+    };
+
+    struct TraceRecord {
+        double time;
+        TraceChannel channel;
+        int value;
+    };
+
+    /**
+     * Reads a whole trace file.
+     *
+     * @param filePath path of the trace.
+     * @return the records of the trace, in file order.
+     */
+    inline std::vector<TraceRecord> readTrace(const std::string& filePath) {
+        std::ifstream file(filePath);
+        if (!file) {
+            throw std::runtime_error("cannot open input trace " + filePath);
+        }
+        std::vector<TraceRecord> records;
+        double time;
+        std::string channel;
+        int value;
+        while (file >> time >> channel >> value) {
+            TraceRecord record{time, TraceChannel::Button, value};
+            if (channel == "button") {
+                record.channel = TraceChannel::Button;
+            } else if (channel == "submit") {
+                record.channel = TraceChannel::Submit;
+            } else if (channel == "x") {
+                record.channel = TraceChannel::X;
+            } else if (channel == "y") {
+                record.channel = TraceChannel::Y;
+            } else {
+                throw std::runtime_error(filePath + ": unknown channel " + channel);
+            }
+            if (!records.empty() && time < records.back().time) {
+                throw std::runtime_error(filePath + ": records are not sorted by time");
+            }
+            records.push_back(record);
+        }
+        if (!file.eof()) {
+            throw std::runtime_error(filePath + ": cannot parse line " + std::to_string(records.size() + 1));
+        }
+        return records;
+    }
+
+    struct TraceInputState {
+        std::size_t next; // Index of the first record sent by the next output
+        double clock;     // Simulation time of the last internal transition
+        double sigma;
+
+        TraceInputState(): next(0), clock(0), sigma(std::numeric_limits<double>::infinity()) {}
+
+        template<typename Archive>
+        void checkpoint(Archive& archive) {
+            archive(next);
+            archive.timeSince(clock);
+            archive.timeLeft(sigma);
+        }
+    };
+
+#if !defined NO_LOGGING || !defined EMBED
+    std::ostream& operator<<(std::ostream &out, const TraceInputState& state) {
+        out << "{" << state.clock << "," << state.sigma << "}";
+        return out;
+    }
+#endif
+
+    class TraceInput : public Atomic<TraceInputState> {
+        std::shared_ptr<const std::vector<TraceRecord>> records;
+
+        // Index of the first record after the ones sharing the timestamp of records[index]
+        [[nodiscard]] std::size_t endOfStep(std::size_t index) const {
+            const double time = (*records)[index].time;
+            while (index < records->size() && (*records)[index].time == time) {
+                index++;
+            }
+            return index;
+        }
+
+        [[nodiscard]] double sigmaFrom(std::size_t index, double clock) const {
+            return index < records->size() ? (*records)[index].time - clock : std::numeric_limits<double>::infinity();
+        }
+
+     public:
+        // Output ports
+        Port<bool> outButton;
+        Port<bool> outSubmit;
+        Port<int> outX;
+        Port<int> outY;
+
+        /**
+         * Constructor function.
+         *
+         * @param id ID of the new TraceInput model object.
+         * @param filePath path of the input trace.
+         */
+        TraceInput(const std::string& id, const char* filePath):
+            Atomic<TraceInputState>(id, TraceInputState()),
+            records(std::make_shared<const std::vector<TraceRecord>>(readTrace(filePath))) {
+            outButton = addOutPort<bool>("outButton");
+            outSubmit = addOutPort<bool>("outSubmit");
+            outX = addOutPort<int>("outX");
+            outY = addOutPort<int>("outY");
+            state.sigma = sigmaFrom(0, 0);
+        }
+
+        /**
+         * Moves on to the records of the next timestamp.
+         *
+         * @param state reference to the current state of the model.
+         */
+        void internalTransition(TraceInputState& state) const override {
+            state.clock += state.sigma;
+            state.next = endOfStep(state.next);
+            state.sigma = sigmaFrom(state.next, state.clock);
+        }
+
+        /**
+         * This model has no input ports, so the external transition is never triggered.
+         *
+         * @param state reference to the current model state.
+         * @param e time elapsed since the last state transition function was triggered.
+         */
+        void externalTransition(TraceInputState& state, double e) const override {
+            state.clock += e;
+            state.sigma -= e;
+        }
+
+        /**
+         * Sends every record of the current timestamp on the port of its channel.
+         *
+         * @param state reference to the current model state.
+         */
+        void output(const TraceInputState& state) const override {
+            if (state.next >= records->size()) {
+                return;
+            }
+            const std::size_t end = endOfStep(state.next);
+            for (std::size_t i = state.next; i < end; i++) {
+                const TraceRecord& record = (*records)[i];
+                switch (record.channel) {
+                    case TraceChannel::Button: outButton->addMessage(record.value != 0); break;
+                    case TraceChannel::Submit: outSubmit->addMessage(record.value != 0); break;
+                    case TraceChannel::X: outX->addMessage(record.value); break;
+                    case TraceChannel::Y: outY->addMessage(record.value); break;
+                }
+            }
+        }
+
+        /**
+         * Returns the value of state.sigma for this model.
+         *
+         * @param state reference to the current model state.
+         * @return the sigma value.
+         */
+        [[nodiscard]] double timeAdvance(const TraceInputState& state) const override {
+            return state.sigma;
+        }
+    };
+} // namespace cadmium::shared
+
+#endif // __TRACE_INPUT_HPP__
@@ -0,0 +1,184 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Throughput benchmark for the example systems (desktop only).
+ *
+ * runBenchmark<TopModel>() simulates the top model twice for the same horizon:
+ *  1. without any logger, measuring the wall time and the peak resident memory
+ *  2. with a CountingLogger, counting the transitions of every atomic model and
+ *     the messages sent on every output port
+ * Per-model rates are the counts of the second run divided by the wall time of
+ * the first one, so the cost of counting is not included in them.
+ *
+ * The results are written as JSON so they can be compared between commits.
+ * The benchmark has to be compiled without NO_LOGGING, otherwise Cadmium never
+ * calls the CountingLogger; the first run still does no logging work because no
+ * logger is set.
+ *
+ * With FLAT_COUPLING, both runs use FlatRootCoordinator instead of RootCoordinator,
+ * so the two builds can be compared ("make bench" and "make bench-flat").
+ *
+ * writeBenchmark() does the same for a top model built with more arguments than its
+ * name, and is also run by the --bench option of runner.hpp.
+ */
+
+#ifndef __BENCHMARK_HPP__
+#define __BENCHMARK_HPP__
+
+#include <simulation/root_coordinator.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#if defined __unix__ || defined __APPLE__
+    #include <sys/resource.h>
+#endif
+
+#include "countingLogger.hpp"
+#ifdef FLAT_COUPLING
+    #include "flatRootCoordinator.hpp"
+#endif
+
+namespace cadmium {
+
+#ifdef FLAT_COUPLING
+    using DesktopRootCoordinator = FlatRootCoordinator;
+#else
+    using DesktopRootCoordinator = RootCoordinator;
+#endif
+
+    /**
+     * Returns the peak resident memory of the process so far.
+     *
+     * @return peak resident set size in kilobytes, or -1 if it is not available.
+     */
+    inline long peakResidentKilobytes() {
+#if defined __unix__ || defined __APPLE__
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return -1;
+        }
+    #ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // Reported in bytes on macOS
+    #else
+        return usage.ru_maxrss;        // Reported in kilobytes on Linux
+    #endif
+#else
+        return -1;
+#endif
+    }
+
+    inline std::string jsonString(const std::string& str) {
+        std::string quoted = "\"";
+        for (const char c : str) {
+            if (c == '"' || c == '\\') {
+                quoted += '\\';
+            }
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    /**
+     * Benchmarks a top model and writes the results as JSON.
+     *
+     * @param name name given to the top model.
+     * @param horizon simulated seconds.
+     * @param outputPath JSON file written.
+     * @param args arguments given to the constructor of the top model after its name.
+     * @return exit code of the program.
+     */
+    template<typename TopModel, typename... Args>
+    int writeBenchmark(const std::string& name, double horizon, const std::string& outputPath, const Args&... args) {
+        // Timed run, without a logger
+        const auto wallStart = std::chrono::steady_clock::now();
+        {
+            auto rootCoordinator = DesktopRootCoordinator(std::make_shared<TopModel>(name, args...));
+            rootCoordinator.start();
+            rootCoordinator.simulate(horizon);
+            rootCoordinator.stop();
+        }
+        const double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+        const long peakRss = peakResidentKilobytes();
+
+        // Counting run
+        SimulationCounts counts;
+        {
+            auto rootCoordinator = DesktopRootCoordinator(std::make_shared<TopModel>(name, args...));
+            rootCoordinator.template setLogger<CountingLogger>(&counts);
+            rootCoordinator.start();
+            rootCoordinator.simulate(horizon);
+            rootCoordinator.stop();
+        }
+
+        uint64_t totalTransitions = 0;
+        uint64_t totalMessages = 0;
+        for (const auto& [id, model] : counts.models) {
+            totalTransitions += model.transitions();
+            for (const auto& [port, messages] : model.messages) {
+                totalMessages += messages;
+            }
+        }
+        const auto rate = [wallTime](uint64_t count) {
+            return wallTime > 0 ? static_cast<double>(count) / wallTime : 0.0;
+        };
+
+        std::ofstream out(outputPath);
+        if (!out) {
+            std::cerr << "benchmark: cannot create " << outputPath << std::endl;
+            return 1;
+        }
+        out << "{\n";
+        out << "  \"system\": " << jsonString(name) << ",\n";
+        out << "  \"horizon\": " << horizon << ",\n";
+        out << "  \"wall_time_s\": " << wallTime << ",\n";
+        out << "  \"peak_rss_kb\": " << peakRss << ",\n";
+        out << "  \"transitions\": " << totalTransitions << ",\n";
+        out << "  \"transitions_per_s\": " << rate(totalTransitions) << ",\n";
+        out << "  \"messages\": " << totalMessages << ",\n";
+        out << "  \"models\": [";
+        bool firstModel = true;
+        for (const auto& [id, model] : counts.models) {
+            out << (firstModel ? "\n" : ",\n");
+            firstModel = false;
+            out << "    {\"id\": " << id << ", \"name\": " << jsonString(model.name)
+                << ", \"transitions\": " << model.transitions()
+                << ", \"transitions_per_s\": " << rate(model.transitions()) << ", \"messages\": {";
+            bool firstPort = true;
+            for (const auto& [port, messages] : model.messages) {
+                out << (firstPort ? "" : ", ") << jsonString(port) << ": " << messages;
+                firstPort = false;
+            }
+            out << "}}";
+        }
+        out << "\n  ]\n}\n";
+
+        std::cout << name << ": " << totalTransitions << " transitions in " << wallTime << " s ("
+                  << rate(totalTransitions) << " per second), results written to " << outputPath << std::endl;
+        return 0;
+    }
+
+    /**
+     * Benchmarks a top model built from its name only.
+     *
+     * Command line: [horizon in simulated seconds, default 1e6] [JSON file, default <name>Bench.json]
+     *
+     * @param name name given to the top model.
+     * @param argc number of command line arguments.
+     * @param argv command line arguments.
+     * @return exit code of the program.
+     */
+    template<typename TopModel>
+    int runBenchmark(const std::string& name, int argc, char* argv[]) {
+        const double horizon = argc > 1 ? std::strtod(argv[1], nullptr) : 1e6;
+        const std::string outputPath = argc > 2 ? argv[2] : name + "Bench.json";
+        return writeBenchmark<TopModel>(name, horizon, outputPath);
+    }
+} // namespace cadmium
+
+#endif // __BENCHMARK_HPP__
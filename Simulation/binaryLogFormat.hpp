@@ -0,0 +1,45 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Layout of the binary trace files written by BinaryLogger and read back by
+ * Tools/binaryLogToCsv.cpp. It only depends on the standard library, so the
+ * converter can be built without Cadmium.
+ *
+ * A file starts with a header:
+ *   char[4]  magic "CDBL"
+ *   uint32   format version
+ *   uint32   length of the CSV separator, followed by its bytes
+ *
+ * followed by records, each starting with a one byte RecordType:
+ *   ModelName  int64 model id, uint32 length, name bytes
+ *   PortName   uint32 port id, uint32 length, name bytes
+ *   Output     double time, int64 model id, uint32 port id, uint32 length, message bytes
+ *   State      double time, int64 model id, uint32 length, state bytes
+ *
+ * Model and port names are written once, the first time they are used, and are
+ * then referred to by their id. Numbers are stored in the byte order of the
+ * machine that wrote the file, so traces should be converted on the same kind
+ * of machine (any desktop x86 or ARM build).
+ */
+
+#ifndef __BINARY_LOG_FORMAT_HPP__
+#define __BINARY_LOG_FORMAT_HPP__
+
+#include <cstdint>
+
+namespace cadmium::binlog {
+
+    constexpr char MAGIC[4] = {'C', 'D', 'B', 'L'};
+    constexpr uint32_t VERSION = 1;
+
+    enum class RecordType : uint8_t {
+        ModelName = 1,
+        PortName = 2,
+        Output = 3,
+        State = 4
+    };
+
+} // namespace cadmium::binlog
+
+#endif // __BINARY_LOG_FORMAT_HPP__
@@ -0,0 +1,140 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * BinaryLogger is a drop-in replacement for CSVLogger in desktop simulations.
+ * Instead of formatting one text row per event, it appends a binary record to
+ * an in-memory buffer that is written to the file in large blocks:
+ *  - the simulation time is stored as a raw double
+ *  - model and port names are stored once and then referred to by an integer id
+ *  - messages and states are stored as length-prefixed bytes, without separators
+ *
+ * The resulting trace is converted back to the exact CSV CSVLogger would have
+ * produced with Tools/binaryLogToCsv, so existing analysis scripts keep working.
+ * The file layout is described in binaryLogFormat.hpp.
+ *
+ * Cadmium formats messages and states with their operator<< before calling the
+ * logger, so that part of the cost remains; what is saved is the time, id and
+ * name formatting, the separators and the per-row flush done by std::endl.
+ */
+
+#ifndef __BINARY_LOGGER_HPP__
+#define __BINARY_LOGGER_HPP__
+
+#include <simulation/logger/logger.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "binaryLogFormat.hpp"
+
+namespace cadmium {
+
+    class BinaryLogger : public Logger {
+        std::string filepath;
+        std::string sep;
+        std::ofstream file;
+        std::vector<char> buffer;
+        std::size_t bufferSize;
+        std::unordered_set<long> modelIds;                // Models whose name was already written
+        std::unordered_map<std::string, uint32_t> portIds; // Id given to every port name already written
+
+        template<typename T>
+        void write(const T& value) {
+            const auto* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void write(const std::string& str) {
+            write(static_cast<uint32_t>(str.size()));
+            buffer.insert(buffer.end(), str.begin(), str.end());
+        }
+
+        void flush() {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+
+        void flushIfFull() {
+            if (buffer.size() >= bufferSize) {
+                flush();
+            }
+        }
+
+        void writeModelName(long modelId, const std::string& modelName) {
+            if (modelIds.insert(modelId).second) {
+                write(binlog::RecordType::ModelName);
+                write(static_cast<int64_t>(modelId));
+                write(modelName);
+            }
+        }
+
+        uint32_t writePortName(const std::string& portName) {
+            const auto it = portIds.find(portName);
+            if (it != portIds.end()) {
+                return it->second;
+            }
+            const auto portId = static_cast<uint32_t>(portIds.size());
+            portIds.emplace(portName, portId);
+            write(binlog::RecordType::PortName);
+            write(portId);
+            write(portName);
+            return portId;
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param filepath path of the binary trace file to be created.
+         * @param sep separator the converter will use when regenerating the CSV file.
+         * @param bufferSize number of bytes kept in memory before they are written to the file.
+         */
+        BinaryLogger(std::string filepath, std::string sep, std::size_t bufferSize = 1 << 20):
+            Logger(), filepath(std::move(filepath)), sep(std::move(sep)), file(), buffer(), bufferSize(bufferSize),
+            modelIds(), portIds() {
+            buffer.reserve(bufferSize + 256);
+        }
+
+        explicit BinaryLogger(std::string filepath): BinaryLogger(std::move(filepath), ";") {}
+
+        void start() override {
+            file.open(filepath, std::ios::binary | std::ios::trunc);
+            buffer.insert(buffer.end(), binlog::MAGIC, binlog::MAGIC + sizeof(binlog::MAGIC));
+            write(binlog::VERSION);
+            write(sep);
+        }
+
+        void stop() override {
+            flush();
+            file.close();
+        }
+
+        void logOutput(double time, long modelId, const std::string& modelName, const std::string& portName, const std::string& output) override {
+            writeModelName(modelId, modelName);
+            const uint32_t portId = writePortName(portName);
+            write(binlog::RecordType::Output);
+            write(time);
+            write(static_cast<int64_t>(modelId));
+            write(portId);
+            write(output);
+            flushIfFull();
+        }
+
+        void logState(double time, long modelId, const std::string& modelName, const std::string& state) override {
+            writeModelName(modelId, modelName);
+            write(binlog::RecordType::State);
+            write(time);
+            write(static_cast<int64_t>(modelId));
+            write(state);
+            flushIfFull();
+        }
+    };
+} // namespace cadmium
+
+#endif // __BINARY_LOGGER_HPP__
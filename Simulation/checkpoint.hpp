@@ -0,0 +1,442 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Checkpoint and restore of a whole simulation (desktop only).
+ *
+ * Checkpointer<States...>::save() walks the simulators of a RootCoordinator and
+ * writes the state of every atomic model to a binary file, together with the
+ * time of the checkpoint and the next event time of every model. restore() loads
+ * such a file into a freshly built copy of the same top model, so a long run can
+ * be resumed, or several "what-if" runs can be forked from a common prefix,
+ * without simulating the prefix again:
+ *
+ *     auto rootCoordinator = RootCoordinator(model, checkpointTime("prefix.ckpt"));
+ *     ElevatorCheckpointer::restore(rootCoordinator, "prefix.ckpt");
+ *     rootCoordinator.start();
+ *     rootCoordinator.simulate(1000.0);
+ *
+ * The models of the restored simulation may get different parameters (e.g. a new
+ * floor travel time); only their ids and state types have to match.
+ *
+ * A state type takes part by listing its fields in a checkpoint member, which
+ * Checkpointer finds by its name, so the states need no other marker or comment:
+ *
+ *     template<typename Archive>
+ *     void checkpoint(Archive& archive) {
+ *         archive.timeLeft(sigma);
+ *         archive(floorNum, floorToMove, currentStatus);
+ *     }
+ *
+ * The same function is used to save and to load the state, so the two cannot
+ * drift apart. Arithmetic types, enums, trivially copyable structs, std::string,
+ * std::vector, std::set, std::pair and types with their own checkpoint member can
+ * be listed. Fields holding a time have to be marked, because the restored run
+ * starts every model at the checkpoint time instead of its last transition:
+ *  - timeLeft(field): time until an event, measured from the last transition (sigma)
+ *  - timeSince(field): time since an event, measured at the last transition (clocks)
+ * The saved values are those the fields would have after an external transition
+ * with no input at the checkpoint time, and restore() checks that every model
+ * gets back the next event time it had when it was saved. archive.loading is
+ * true while restoring, for a state rebuilding what lives outside the model
+ * (e.g. the open episode of a metric, see Shared_Models/metricObservers.hpp).
+ *
+ * Atomic models whose state type is not listed in States (like Cadmium's IEStream,
+ * whose input file position is not accessible) make save() throw; the example
+ * systems read their inputs with BinaryInputStream when checkpointing.
+ *
+ * The file layout is:
+ *   char[4]  magic "CDCK"
+ *   uint32   format version
+ *   double   time of the checkpoint
+ *   uint32   number of atomic models, followed by one record per model:
+ *     uint32 length, path of the model (ids from the top model, separated by '/')
+ *     double next event time
+ *     uint8  1 if the model still had messages queued by its constructor, not sent yet
+ *     uint32 length, state bytes
+ * Numbers are stored in the byte order of the machine that wrote the file.
+ */
+
+#ifndef __CHECKPOINT_HPP__
+#define __CHECKPOINT_HPP__
+
+#include <modeling/devs/atomic.hpp>
+#include <simulation/root_coordinator.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cadmium {
+
+    namespace checkpoint {
+        constexpr char MAGIC[4] = {'C', 'D', 'C', 'K'};
+        constexpr uint32_t VERSION = 1;
+
+        template<typename T> struct IsVector : std::false_type {};
+        template<typename T, typename A> struct IsVector<std::vector<T, A>> : std::true_type {};
+        template<typename T> struct IsSet : std::false_type {};
+        template<typename T, typename C, typename A> struct IsSet<std::set<T, C, A>> : std::true_type {};
+        template<typename T> struct IsPair : std::false_type {};
+        template<typename A, typename B> struct IsPair<std::pair<A, B>> : std::true_type {};
+
+        template<typename T, typename Archive, typename = void>
+        struct HasCheckpoint : std::false_type {};
+        template<typename T, typename Archive>
+        struct HasCheckpoint<T, Archive, std::void_t<decltype(std::declval<T&>().checkpoint(std::declval<Archive&>()))>> : std::true_type {};
+    } // namespace checkpoint
+
+    // Archive appending the fields of a state to a byte string
+    class CheckpointWriter {
+        std::string& bytes;
+        double elapsed; // Time between the last transition of the model and the checkpoint
+
+        template<typename T>
+        void raw(const T& value) {
+            bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        void write(const T& value) {
+            if constexpr (checkpoint::HasCheckpoint<T, CheckpointWriter>::value) {
+                const_cast<T&>(value).checkpoint(*this); // Only reads the fields
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                raw(static_cast<uint32_t>(value.size()));
+                bytes.append(value);
+            } else if constexpr (checkpoint::IsVector<T>::value || checkpoint::IsSet<T>::value) {
+                raw(static_cast<uint32_t>(value.size()));
+                for (const auto& item : value) {
+                    write(item);
+                }
+            } else if constexpr (checkpoint::IsPair<T>::value) {
+                write(value.first);
+                write(value.second);
+            } else {
+                static_assert(std::is_trivially_copyable_v<T>, "add a checkpoint member to this type to list its fields");
+                raw(value);
+            }
+        }
+
+     public:
+        static constexpr bool loading = false;
+
+        CheckpointWriter(std::string& bytes, double elapsed): bytes(bytes), elapsed(elapsed) {}
+
+        template<typename... Ts>
+        void operator()(const Ts&... values) {
+            (write(values), ...);
+        }
+
+        void timeLeft(const double& time) {
+            raw(time - elapsed);
+        }
+
+        void timeSince(const double& time) {
+            raw(time + elapsed);
+        }
+    };
+
+    // Archive reading back the fields written by CheckpointWriter
+    class CheckpointReader {
+        const std::string& bytes;
+        std::size_t position;
+
+        template<typename T>
+        void raw(T& value) {
+            if (bytes.size() - position < sizeof(T)) {
+                throw std::runtime_error("checkpoint: state record is too short");
+            }
+            std::memcpy(&value, bytes.data() + position, sizeof(T));
+            position += sizeof(T);
+        }
+
+        uint32_t readSize() {
+            uint32_t size;
+            raw(size);
+            if (size > bytes.size() - position) {
+                throw std::runtime_error("checkpoint: state record is too short");
+            }
+            return size;
+        }
+
+        template<typename T>
+        void read(T& value) {
+            if constexpr (checkpoint::HasCheckpoint<T, CheckpointReader>::value) {
+                value.checkpoint(*this);
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                const uint32_t size = readSize();
+                value.assign(bytes.data() + position, size);
+                position += size;
+            } else if constexpr (checkpoint::IsVector<T>::value) {
+                value.resize(readSize());
+                for (auto& item : value) {
+                    read(item);
+                }
+            } else if constexpr (checkpoint::IsSet<T>::value) {
+                const uint32_t size = readSize();
+                value.clear();
+                for (uint32_t i = 0; i < size; i++) {
+                    typename T::value_type item;
+                    read(item);
+                    value.insert(value.end(), std::move(item));
+                }
+            } else if constexpr (checkpoint::IsPair<T>::value) {
+                read(value.first);
+                read(value.second);
+            } else {
+                static_assert(std::is_trivially_copyable_v<T>, "add a checkpoint member to this type to list its fields");
+                raw(value);
+            }
+        }
+
+     public:
+        static constexpr bool loading = true;
+
+        explicit CheckpointReader(const std::string& bytes): bytes(bytes), position(0) {}
+
+        template<typename... Ts>
+        void operator()(Ts&... values) {
+            (read(values), ...);
+        }
+
+        void timeLeft(double& time) {
+            raw(time);
+        }
+
+        void timeSince(double& time) {
+            raw(time);
+        }
+
+        [[nodiscard]] bool finished() const {
+            return position == bytes.size();
+        }
+    };
+
+    /**
+     * Reads the time a checkpoint was taken at, which the restored RootCoordinator has to start from.
+     *
+     * @param filePath path of the checkpoint.
+     * @return the simulation time of the checkpoint.
+     */
+    inline double checkpointTime(const std::string& filePath) {
+        std::ifstream file(filePath, std::ios::binary);
+        char magic[4];
+        uint32_t version;
+        double time;
+        if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, checkpoint::MAGIC, sizeof(magic)) != 0
+            || !file.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != checkpoint::VERSION
+            || !file.read(reinterpret_cast<char*>(&time), sizeof(time))) {
+            throw std::runtime_error(filePath + " is not a checkpoint");
+        }
+        return time;
+    }
+
+    template<typename... States>
+    class Checkpointer {
+
+        // Atomic model found in the simulator tree, with its path and simulator times
+        struct ModelEntry {
+            std::string path;
+            std::shared_ptr<AtomicInterface> model;
+            double timeLast;
+            double timeNext;
+        };
+
+        static void collect(const std::shared_ptr<AbstractSimulator>& simulator, const std::string& prefix, std::vector<ModelEntry>& models) {
+            const std::string path = prefix + simulator->getComponent()->getId();
+            if (auto coordinator = std::dynamic_pointer_cast<Coordinator>(simulator)) {
+                for (const auto& sub : coordinator->getSubcomponents()) {
+                    collect(sub, path + "/", models);
+                }
+            } else {
+                models.push_back({path, std::dynamic_pointer_cast<AtomicInterface>(simulator->getComponent()),
+                                  simulator->getTimeLast(), simulator->getTimeNext()});
+            }
+        }
+
+        static bool hasPendingOutput(const AtomicInterface& model) {
+            for (const auto& port : model.getOutPorts()) {
+                if (!port->empty()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static std::vector<ModelEntry> models(RootCoordinator& rootCoordinator) {
+            std::vector<ModelEntry> entries;
+            collect(rootCoordinator.getTopCoordinator(), "", entries);
+            return entries;
+        }
+
+        // Gives access to the protected state of an Atomic<S>
+        template<typename S>
+        struct StateAccess : Atomic<S> {
+            static S& of(Atomic<S>& model) {
+                return model.*(&StateAccess::state);
+            }
+        };
+
+        template<typename S>
+        static bool trySave(AtomicInterface& model, double elapsed, std::string& bytes) {
+            auto* atomic = dynamic_cast<Atomic<S>*>(&model);
+            if (atomic == nullptr) {
+                return false;
+            }
+            CheckpointWriter writer(bytes, elapsed);
+            writer(StateAccess<S>::of(*atomic));
+            return true;
+        }
+
+        template<typename S>
+        static bool tryRestore(AtomicInterface& model, const std::string& bytes) {
+            auto* atomic = dynamic_cast<Atomic<S>*>(&model);
+            if (atomic == nullptr) {
+                return false;
+            }
+            CheckpointReader reader(bytes);
+            reader(StateAccess<S>::of(*atomic));
+            if (!reader.finished()) {
+                throw std::runtime_error("checkpoint: state record of " + model.getId() + " is too long");
+            }
+            return true;
+        }
+
+        template<typename T>
+        static void write(std::ofstream& file, const T& value) {
+            file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        static void write(std::ofstream& file, const std::string& str) {
+            write(file, static_cast<uint32_t>(str.size()));
+            file.write(str.data(), static_cast<std::streamsize>(str.size()));
+        }
+
+        template<typename T>
+        static void read(std::ifstream& file, T& value) {
+            if (!file.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+                throw std::runtime_error("checkpoint: file is truncated");
+            }
+        }
+
+        static void read(std::ifstream& file, std::string& str) {
+            uint32_t size;
+            read(file, size);
+            str.resize(size);
+            if (!file.read(str.data(), size)) {
+                throw std::runtime_error("checkpoint: file is truncated");
+            }
+        }
+
+     public:
+        /**
+         * Writes the state of every atomic model to a checkpoint file.
+         *
+         * @param rootCoordinator coordinator of the simulation, between two calls to simulate().
+         * @param time simulation time of the checkpoint, e.g. the horizon simulate() stopped at. It must
+         *             not be before the last transition nor after the next event of any model.
+         * @param filePath path of the checkpoint.
+         */
+        static void save(RootCoordinator& rootCoordinator, double time, const std::string& filePath) {
+            const auto entries = models(rootCoordinator);
+            std::ofstream file(filePath, std::ios::binary);
+            if (!file) {
+                throw std::runtime_error("checkpoint: cannot create " + filePath);
+            }
+            file.write(checkpoint::MAGIC, sizeof(checkpoint::MAGIC));
+            write(file, checkpoint::VERSION);
+            write(file, time);
+            write(file, static_cast<uint32_t>(entries.size()));
+            for (const auto& entry : entries) {
+                if (time < entry.timeLast || time > entry.timeNext) {
+                    throw std::runtime_error("checkpoint: " + entry.path + " has events between its last transition and the checkpoint time");
+                }
+                std::string bytes;
+                if (!(trySave<States>(*entry.model, time - entry.timeLast, bytes) || ...)) {
+                    throw std::runtime_error("checkpoint: the state of " + entry.path + " cannot be saved");
+                }
+                write(file, entry.path);
+                write(file, entry.timeNext);
+                write(file, static_cast<uint8_t>(hasPendingOutput(*entry.model) ? 1 : 0));
+                write(file, bytes);
+            }
+            if (!file) {
+                throw std::runtime_error("checkpoint: cannot write " + filePath);
+            }
+        }
+
+        /**
+         * Loads a checkpoint into a new simulation of the same top model. The root coordinator
+         * must have been created with the time of the checkpoint (see checkpointTime()), and
+         * start() must not have been called yet.
+         *
+         * @param rootCoordinator coordinator of the new simulation.
+         * @param filePath path of the checkpoint.
+         */
+        static void restore(RootCoordinator& rootCoordinator, const std::string& filePath) {
+            std::ifstream file(filePath, std::ios::binary);
+            char magic[4];
+            uint32_t version;
+            double time;
+            uint32_t count;
+            if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, checkpoint::MAGIC, sizeof(magic)) != 0) {
+                throw std::runtime_error(filePath + " is not a checkpoint");
+            }
+            read(file, version);
+            if (version != checkpoint::VERSION) {
+                throw std::runtime_error(filePath + ": unsupported checkpoint version " + std::to_string(version));
+            }
+            read(file, time);
+            read(file, count);
+
+            std::map<std::string, std::shared_ptr<AtomicInterface>> byPath;
+            for (const auto& entry : models(rootCoordinator)) {
+                byPath[entry.path] = entry.model;
+            }
+            if (count != byPath.size()) {
+                throw std::runtime_error(filePath + ": the checkpoint has " + std::to_string(count)
+                                         + " atomic models, the simulation " + std::to_string(byPath.size()));
+            }
+
+            for (uint32_t i = 0; i < count; i++) {
+                std::string path;
+                double timeNext;
+                uint8_t pendingOutput;
+                std::string bytes;
+                read(file, path);
+                read(file, timeNext);
+                read(file, pendingOutput);
+                read(file, bytes);
+                const auto it = byPath.find(path);
+                if (it == byPath.end()) {
+                    throw std::runtime_error(filePath + ": no model " + path + " in the simulation");
+                }
+                AtomicInterface& model = *it->second;
+                if (!(tryRestore<States>(model, bytes) || ...)) {
+                    throw std::runtime_error("checkpoint: the state of " + path + " cannot be restored");
+                }
+                // Messages queued by the constructor are only sent again if they had not been sent yet
+                if (pendingOutput == 0) {
+                    model.clearPorts();
+                }
+
+                const double restoredNext = time + model.timeAdvance();
+                if (restoredNext != timeNext && std::abs(restoredNext - timeNext) > 1e-9 * std::max(1.0, std::abs(timeNext))) {
+                    throw std::runtime_error("checkpoint: " + path + " would resume at " + std::to_string(restoredNext)
+                                             + " instead of " + std::to_string(timeNext));
+                }
+            }
+        }
+    };
+} // namespace cadmium
+
+#endif // __CHECKPOINT_HPP__
@@ -0,0 +1,94 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Command line driver saving and resuming checkpoints of the example systems (desktop only).
+ *
+ * runCheckpoint<TopModel, States...>() simulates the top model up to a given time,
+ * starting either from t=0 or from a checkpoint written by an earlier run, and can
+ * save a new checkpoint when it stops. A soak run can then be split into several
+ * shorter runs, and several runs can be forked from the same prefix:
+ *
+ *     ./elevatorKylerCheckpoint --until 500 --save prefix.ckpt
+ *     ./elevatorKylerCheckpoint --resume prefix.ckpt --until 1000 --log a.csv
+ *     ./elevatorKylerCheckpoint --resume prefix.ckpt --until 2000 --log b.csv
+ *
+ * The states listed in States are those of every atomic model of the top model,
+ * see checkpoint.hpp. The inputs have to be read with BinaryInputStream (built
+ * with BINARY_INPUT), as the position of Cadmium's IEStream cannot be saved.
+ */
+
+#ifndef __CHECKPOINT_RUN_HPP__
+#define __CHECKPOINT_RUN_HPP__
+
+#include <simulation/root_coordinator.hpp>
+#ifndef NO_LOGGING
+    #include <simulation/logger/csv.hpp>
+#endif
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "checkpoint.hpp"
+#include "commandLine.hpp"
+
+namespace cadmium {
+
+    /**
+     * Runs a top model between two checkpoints.
+     *
+     * Command line: [--resume checkpoint] [--until time, default 1000] [--save checkpoint]
+     *               [--log CSV file, default <name>Checkpoint.csv]
+     *
+     * @param name name given to the top model.
+     * @param argc number of command line arguments.
+     * @param argv command line arguments.
+     * @return exit code of the program.
+     */
+    template<typename TopModel, typename... States>
+    int runCheckpoint(const std::string& name, int argc, char* argv[]) {
+        std::string resumePath;
+        std::string savePath;
+        std::string logPath = name + "Checkpoint.csv";
+        double until = 1000.0;
+
+        if (!parseCommandLine(argc, argv, {
+                {"--resume", "checkpoint", textOption(resumePath)},
+                {"--until", "time", numberOption(until)},
+                {"--save", "checkpoint", textOption(savePath)},
+                {"--log", "file.csv", textOption(logPath)}})) {
+            return 1;
+        }
+
+        try {
+            const double start = resumePath.empty() ? 0.0 : checkpointTime(resumePath);
+            if (until < start) {
+                std::cerr << "The checkpoint was taken at " << start << ", after " << until << std::endl;
+                return 1;
+            }
+
+            auto rootCoordinator = RootCoordinator(std::make_shared<TopModel>(name), start);
+            if (!resumePath.empty()) {
+                Checkpointer<States...>::restore(rootCoordinator, resumePath);
+            }
+#ifndef NO_LOGGING
+            rootCoordinator.template setLogger<CSVLogger>(logPath, ",");
+#endif
+            rootCoordinator.start();
+            rootCoordinator.simulate(until - start);
+            rootCoordinator.stop();
+
+            if (!savePath.empty()) {
+                Checkpointer<States...>::save(rootCoordinator, until, savePath);
+                std::cout << name << ": checkpoint at " << until << " written to " << savePath << std::endl;
+            }
+        } catch (const std::exception& e) {
+            std::cerr << name << ": " << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+} // namespace cadmium
+
+#endif // __CHECKPOINT_RUN_HPP__
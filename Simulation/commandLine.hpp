@@ -0,0 +1,160 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Command line options of the desktop drivers (runner, checkpoints, sweeps, building, grid).
+ *
+ * A driver lists its options in a table, each with the value shown in the usage
+ * (nullptr for a flag taking no value) and the handler reading it, and parses its
+ * arguments with parseCommandLine():
+ *
+ *     double horizon = 3600;
+ *     bool display = false;
+ *     if (!cadmium::parseCommandLine(argc, argv, {
+ *             {"--horizon", "3600", cadmium::numberOption(horizon)},
+ *             {"--display", nullptr, cadmium::flagOption(display)}})) {
+ *         return 1;
+ *     }
+ *
+ * An unknown option, an option missing its value or a value its handler rejects
+ * print what is wrong and the usage built from the table, and parseCommandLine()
+ * returns false. Numbers have to be written in full: "12abc" is not read as 12.
+ */
+
+#ifndef __COMMAND_LINE_HPP__
+#define __COMMAND_LINE_HPP__
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace cadmium {
+
+    struct CommandOption {
+        const char* name;  // e.g. "--horizon"
+        const char* value; // Value shown in the usage, e.g. the default; nullptr for a flag
+        std::function<void(const std::string&)> read; // Reads the value, throws std::invalid_argument or std::out_of_range to reject it
+    };
+
+    /**
+     * Reads a whole command line value as a number.
+     *
+     * @param value text of the value.
+     * @return the number.
+     */
+    inline double parseNumber(const std::string& value) {
+        std::size_t end = 0;
+        const double number = std::stod(value, &end);
+        if (end != value.size()) {
+            throw std::invalid_argument(value);
+        }
+        return number;
+    }
+
+    /**
+     * Reads a whole command line value as an integer.
+     *
+     * @param value text of the value.
+     * @return the integer.
+     */
+    inline long long parseInteger(const std::string& value) {
+        std::size_t end = 0;
+        const long long integer = std::stoll(value, &end);
+        if (end != value.size()) {
+            throw std::invalid_argument(value);
+        }
+        return integer;
+    }
+
+    inline std::function<void(const std::string&)> numberOption(double& target) {
+        return [&target](const std::string& value) { target = parseNumber(value); };
+    }
+
+    // Reads an integer into target, rejecting the values its type cannot hold (e.g. -1 for an unsigned)
+    template<typename T>
+    std::function<void(const std::string&)> integerOption(T& target) {
+        return [&target](const std::string& value) {
+            const long long integer = parseInteger(value);
+            if (integer < static_cast<long long>(std::numeric_limits<T>::min())
+                || static_cast<unsigned long long>(integer) > static_cast<unsigned long long>(std::numeric_limits<T>::max())) {
+                throw std::out_of_range(value);
+            }
+            target = static_cast<T>(integer);
+        };
+    }
+
+    inline std::function<void(const std::string&)> textOption(std::string& target) {
+        return [&target](const std::string& value) { target = value; };
+    }
+
+    inline std::function<void(const std::string&)> flagOption(bool& target) {
+        return [&target](const std::string&) { target = true; };
+    }
+
+    /**
+     * Prints the options of a table.
+     *
+     * @param program name of the program, argv[0].
+     * @param options options of the program.
+     */
+    inline void printUsage(const char* program, std::initializer_list<CommandOption> options) {
+        const std::string start = std::string("Usage: ") + program;
+        std::string line = start;
+        for (const auto& option : options) {
+            std::string item = std::string(" [") + option.name + (option.value != nullptr ? std::string(" ") + option.value : "") + "]";
+            if (line.size() > start.size() && line.size() + item.size() > 100) {
+                std::cerr << line << "\n";
+                line = std::string(start.size(), ' ');
+            }
+            line += item;
+        }
+        std::cerr << line << std::endl;
+    }
+
+    /**
+     * Reads the command line with a table of options.
+     *
+     * @param argc number of command line arguments.
+     * @param argv command line arguments.
+     * @param options options of the program.
+     * @return whether the command line was read; otherwise the error and the usage were printed.
+     */
+    inline bool parseCommandLine(int argc, char* argv[], std::initializer_list<CommandOption> options) {
+        for (int i = 1; i < argc; i++) {
+            const std::string name = argv[i];
+            const CommandOption* option = nullptr;
+            for (const auto& candidate : options) {
+                option = name == candidate.name ? &candidate : option;
+            }
+            if (option == nullptr) {
+                std::cerr << "Unknown option " << name << std::endl;
+                printUsage(argv[0], options);
+                return false;
+            }
+            if (option->value != nullptr && i + 1 == argc) {
+                std::cerr << "Missing value for " << name << std::endl;
+                printUsage(argv[0], options);
+                return false;
+            }
+            const std::string value = option->value != nullptr ? argv[++i] : "";
+            try {
+                option->read(value);
+            } catch (const std::invalid_argument&) {
+                std::cerr << "Invalid value " << value << " for " << name << std::endl;
+                printUsage(argv[0], options);
+                return false;
+            } catch (const std::out_of_range&) {
+                std::cerr << "Value " << value << " out of range for " << name << std::endl;
+                printUsage(argv[0], options);
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace cadmium
+
+#endif // __COMMAND_LINE_HPP__
@@ -0,0 +1,68 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * CountingLogger does not write anything. It counts the state transitions of
+ * every atomic model and the messages sent on each of its output ports into a
+ * SimulationCounts object owned by the caller, so a benchmark can report them once
+ * the simulation is over.
+ */
+
+#ifndef __COUNTING_LOGGER_HPP__
+#define __COUNTING_LOGGER_HPP__
+
+#include <simulation/logger/logger.hpp>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace cadmium {
+
+    struct ModelCounts {
+        std::string name;
+        uint64_t stateRecords = 0;                // Includes the initial state logged when the simulation starts
+        std::map<std::string, uint64_t> messages; // Messages sent on each output port
+
+        [[nodiscard]] uint64_t transitions() const {
+            return stateRecords > 0 ? stateRecords - 1 : 0;
+        }
+    };
+
+    struct SimulationCounts {
+        std::map<long, ModelCounts> models; // Ordered by model id, so reports are stable between runs
+    };
+
+    class CountingLogger : public Logger {
+        SimulationCounts* counts;
+
+        ModelCounts& model(long modelId, const std::string& modelName) {
+            ModelCounts& model = counts->models[modelId];
+            if (model.name.empty()) {
+                model.name = modelName;
+            }
+            return model;
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param counts object the counts are added to.
+         */
+        explicit CountingLogger(SimulationCounts* counts): Logger(), counts(counts) {}
+
+        void start() override {}
+
+        void stop() override {}
+
+        void logOutput(double time, long modelId, const std::string& modelName, const std::string& portName, const std::string& output) override {
+            model(modelId, modelName).messages[portName]++;
+        }
+
+        void logState(double time, long modelId, const std::string& modelName, const std::string& state) override {
+            model(modelId, modelName).stateRecords++;
+        }
+    };
+} // namespace cadmium
+
+#endif // __COUNTING_LOGGER_HPP__
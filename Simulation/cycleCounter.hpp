@@ -0,0 +1,72 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Cheap timestamps for the probes of Simulation/latency.hpp and
+ * Simulation/transitionProfiler.hpp.
+ *
+ * On the MSP432 (EMBED), cycleNow() reads the DWT cycle counter of the Cortex-M4,
+ * which startCycleCounter() enables. The 32-bit counter wraps after about 89 s at
+ * 48 MHz, so only shorter durations can be measured, but differences of two
+ * timestamps stay correct across a wrap. On the desktop it reads
+ * std::chrono::steady_clock, in nanoseconds.
+ */
+
+#ifndef __CYCLE_COUNTER_HPP__
+#define __CYCLE_COUNTER_HPP__
+
+#include <cstdint>
+#ifdef EMBED
+    #include <msp.h>
+#else
+    #include <chrono>
+#endif
+
+namespace cadmium {
+
+#ifdef EMBED
+    using CycleTicks = uint32_t;
+
+    inline CycleTicks cycleNow() {
+        return DWT->CYCCNT;
+    }
+
+    inline uint64_t cycleNanoseconds(uint64_t ticks) {
+        return ticks * 1000u / (SystemCoreClock / 1000000u);
+    }
+
+    inline void startCycleCounter() {
+        if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+            CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+            DWT->CYCCNT = 0;
+            DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        }
+    }
+#else
+    using CycleTicks = uint64_t;
+
+    inline CycleTicks cycleNow() {
+        return static_cast<CycleTicks>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    inline uint64_t cycleNanoseconds(uint64_t ticks) {
+        return ticks;
+    }
+
+    inline void startCycleCounter() {}
+#endif
+
+    /**
+     * Converts a duration to microseconds, saturated to 32 bits.
+     *
+     * @param ticks duration, in ticks of cycleNow().
+     * @return the duration in microseconds.
+     */
+    inline uint32_t cycleMicroseconds(uint64_t ticks) {
+        const uint64_t microseconds = cycleNanoseconds(ticks) / 1000u;
+        return microseconds > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(microseconds);
+    }
+} // namespace cadmium
+
+#endif // __CYCLE_COUNTER_HPP__
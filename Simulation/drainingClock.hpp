@@ -0,0 +1,89 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * DrainingClock<Clock> wraps a real-time clock (e.g. TIClock) and prints part of
+ * a LogRingBuffer every time the RealTimeRootCoordinator waits for the next
+ * event. The log is printed in the idle time between events instead of inside
+ * the transitions.
+ *
+ * Each wait prints the log in chunks of CHUNK bytes, as long as the time left
+ * before the next event covers one more chunk. The time left is the gap between
+ * the event the clock last woke up for and the next one, minus the time the
+ * transitions took since, read from the cycle counter (see cycleCounter.hpp). A
+ * long gap prints the whole buffer, and the buffer is always emptied before an
+ * infinite wait (all models passive), so no line stays queued while the board
+ * sleeps. An event due right after the last one prints nothing.
+ *
+ * Printing a byte over the debug UART at 115200 baud takes about 87 us, the
+ * default of secondsPerByte. Semihosting takes much longer; give it a larger
+ * secondsPerByte so the chunks still fit in the time left.
+ */
+
+#ifndef __DRAINING_CLOCK_HPP__
+#define __DRAINING_CLOCK_HPP__
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "cycleCounter.hpp"
+#include "ringBufferLogger.hpp"
+
+namespace cadmium {
+
+    template<typename Clock>
+    class DrainingClock : public Clock {
+        static constexpr std::size_t CHUNK = 16; // Bytes printed between two checks of the time left
+
+        LogRingBuffer* buffer;
+        double secondsPerByte;
+        double timeWoken;    // Simulation time the clock last woke up at
+        CycleTicks wokenAt;  // Cycle counter when the clock last woke up
+
+        // Seconds left before timeNext, or a negative value if it is already due
+        [[nodiscard]] double timeLeft(double timeNext) const {
+            const CycleTicks elapsed = cycleNow() - wokenAt;
+            return timeNext - timeWoken - static_cast<double>(cycleNanoseconds(elapsed)) * 1e-9;
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param buffer ring buffer filled by RingBufferLogger.
+         * @param secondsPerByte time taken to print one byte.
+         */
+        explicit DrainingClock(LogRingBuffer* buffer, double secondsPerByte = 10.0 / 115200):
+            Clock(), buffer(buffer), secondsPerByte(secondsPerByte), timeWoken(0), wokenAt(0) {}
+
+        void start(double timeLast) override {
+            Clock::start(timeLast);
+            startCycleCounter();
+            timeWoken = timeLast;
+            wokenAt = cycleNow();
+        }
+
+        /**
+         * Prints the queued bytes that fit in the time left, then waits as the wrapped clock does.
+         *
+         * @param timeNext simulation time of the next event.
+         * @return the value returned by the wrapped clock.
+         */
+        double waitUntil(double timeNext) override {
+            if (std::isinf(timeNext)) {
+                buffer->drain(buffer->pending());
+            } else {
+                const double chunkTime = static_cast<double>(CHUNK) * secondsPerByte;
+                while (buffer->pending() > 0 && timeLeft(timeNext) > chunkTime) {
+                    buffer->drain(CHUNK);
+                }
+            }
+            timeWoken = Clock::waitUntil(timeNext);
+            wokenAt = cycleNow();
+            return timeWoken;
+        }
+    };
+} // namespace cadmium
+
+#endif // __DRAINING_CLOCK_HPP__
@@ -0,0 +1,385 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Root coordinator routing the messages of a flattened model (desktop only).
+ *
+ * RootCoordinator simulates a coupled model through its tree of coordinators: every
+ * step visits every simulator, and every coupling of every coupled model copies its
+ * source port into its destination port, through the ports of the coupled models in
+ * between, whether the source sent anything or not. FlatRootCoordinator keeps the
+ * same constructor, setLogger(), start(), simulate() and stop(), and at start():
+ *  - lists the atomic models in the order of their ids, with their times, and all
+ *    their ports in two arrays (input and output ports)
+ *  - resolves the EIC, IC and EOC of every coupled model into a routing table: for
+ *    each output port of an atomic model, the indexes of the input ports of atomic
+ *    models its messages reach, whatever the coupled models in between
+ * Each step then only calls output() on the imminent models, copies their non-empty
+ * ports straight into the input ports of the table, and only runs the transitions of
+ * the imminent models and of those that received messages. The logs are those of
+ * RootCoordinator.
+ *
+ * The times of the simulators are written back after every simulate() and stop(), so
+ * Checkpointer and getTopCoordinator()->getTimeNext() can be used as before.
+ *
+ * main.cpp and runBenchmark() use it instead of RootCoordinator when FLAT_COUPLING
+ * is defined. ParallelRootCoordinator runs the same steps on several threads.
+ */
+
+#ifndef __FLAT_ROOT_COORDINATOR_HPP__
+#define __FLAT_ROOT_COORDINATOR_HPP__
+
+#include <simulation/root_coordinator.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cadmium {
+
+    class FlatRootCoordinator : public RootCoordinator {
+
+        // Gives access to the protected times of a simulator
+        struct TimeAccess : AbstractSimulator {
+            static double& lastOf(AbstractSimulator& simulator) {
+                return simulator.*(&TimeAccess::timeLast);
+            }
+
+            static double& nextOf(AbstractSimulator& simulator) {
+                return simulator.*(&TimeAccess::timeNext);
+            }
+        };
+
+        // Coordinator of a coupled model, and the atomic models it contains (first to last - 1)
+        struct CoordinatorRange {
+            AbstractSimulator* coordinator;
+            uint32_t first;
+            uint32_t last;
+        };
+
+        std::shared_ptr<Logger> logger;
+
+        // Atomic models, indexed by model id
+        std::vector<AbstractSimulator*> simulators;
+        std::vector<AtomicInterface*> models;
+        std::vector<double> timeLast;
+        std::vector<double> timeNext;
+        std::vector<CoordinatorRange> coordinators;
+
+        // Ports of model m: outPorts[outStart[m]] to outPorts[outStart[m + 1] - 1], same for inputs
+        std::vector<std::shared_ptr<PortInterface>> outPorts;
+        std::vector<uint32_t> outStart;
+        std::vector<std::shared_ptr<PortInterface>> inPorts;
+        std::vector<uint32_t> inStart;
+        std::vector<uint32_t> inOwner; // Model of each input port
+
+        // Input ports reached by output port p: routeTargets[routeStart[p]] to routeTargets[routeStart[p + 1] - 1]
+        std::vector<uint32_t> routeStart;
+        std::vector<uint32_t> routeTargets;
+
+        std::vector<uint32_t> imminent;
+        std::vector<uint32_t> active;   // Models transitioning in the current step
+        std::vector<uint8_t> received;  // Whether each model received a message in the current step
+        std::vector<uint8_t> scheduled; // Whether each model is in active
+        double timeCurrent;
+        bool constructorMessages;       // Whether messages queued by the constructors can still be waiting
+
+        void collect(const std::shared_ptr<AbstractSimulator>& simulator,
+                     std::unordered_map<const PortInterface*, std::vector<PortInterface*>>& couplings) {
+            if (auto coordinator = std::dynamic_pointer_cast<Coordinator>(simulator)) {
+                const auto coupled = std::dynamic_pointer_cast<Coupled>(coordinator->getComponent());
+                for (const auto* list : {&coupled->getEICs(), &coupled->getICs(), &coupled->getEOCs()}) {
+                    for (const auto& [portFrom, portTo] : *list) {
+                        couplings[portFrom.get()].push_back(portTo.get());
+                    }
+                }
+                const auto first = static_cast<uint32_t>(models.size());
+                for (const auto& sub : coordinator->getSubcomponents()) {
+                    collect(sub, couplings);
+                }
+                coordinators.push_back({coordinator.get(), first, static_cast<uint32_t>(models.size())});
+                return;
+            }
+            auto* model = dynamic_cast<AtomicInterface*>(simulator->getComponent().get());
+            simulators.push_back(simulator.get());
+            models.push_back(model);
+            for (const auto& port : model->getOutPorts()) {
+                outPorts.push_back(port);
+            }
+            outStart.push_back(static_cast<uint32_t>(outPorts.size()));
+            for (const auto& port : model->getInPorts()) {
+                inPorts.push_back(port);
+                inOwner.push_back(static_cast<uint32_t>(models.size() - 1));
+            }
+            inStart.push_back(static_cast<uint32_t>(inPorts.size()));
+        }
+
+        // Adds the input ports of atomic models reached from a port, following the couplings
+        void route(const PortInterface* port, const std::unordered_map<const PortInterface*, std::vector<PortInterface*>>& couplings,
+                   const std::unordered_map<const PortInterface*, uint32_t>& inIndex) {
+            const auto coupled = couplings.find(port);
+            if (coupled == couplings.end()) {
+                return;
+            }
+            for (const PortInterface* next : coupled->second) {
+                const auto target = inIndex.find(next);
+                if (target != inIndex.end()) {
+                    routeTargets.push_back(target->second);
+                } else {
+                    route(next, couplings, inIndex);
+                }
+            }
+        }
+
+        // Builds the model and port arrays, and the routing table
+        void flatten() {
+            simulators.clear();
+            models.clear();
+            coordinators.clear();
+            outPorts.clear();
+            inPorts.clear();
+            inOwner.clear();
+            outStart.assign(1, 0);
+            inStart.assign(1, 0);
+            routeStart.clear();
+            routeTargets.clear();
+
+            std::unordered_map<const PortInterface*, std::vector<PortInterface*>> couplings;
+            collect(getTopCoordinator(), couplings);
+
+            std::unordered_map<const PortInterface*, uint32_t> inIndex;
+            for (uint32_t i = 0; i < inPorts.size(); i++) {
+                inIndex[inPorts[i].get()] = i;
+            }
+            for (const auto& port : outPorts) {
+                routeStart.push_back(static_cast<uint32_t>(routeTargets.size()));
+                route(port.get(), couplings, inIndex);
+            }
+            routeStart.push_back(static_cast<uint32_t>(routeTargets.size()));
+
+            timeLast.resize(models.size());
+            timeNext.resize(models.size());
+            for (std::size_t m = 0; m < models.size(); m++) {
+                timeLast[m] = simulators[m]->getTimeLast();
+                timeNext[m] = simulators[m]->getTimeNext();
+            }
+            received.assign(models.size(), 0);
+            scheduled.assign(models.size(), 0);
+            imminent.reserve(models.size());
+            active.reserve(models.size());
+        }
+
+        // Copies the messages of the output ports of a model into the input ports they are routed to
+        void send(uint32_t model) {
+            for (uint32_t p = outStart[model]; p < outStart[model + 1]; p++) {
+                if (outPorts[p]->empty()) {
+                    continue;
+                }
+                for (uint32_t r = routeStart[p]; r < routeStart[p + 1]; r++) {
+                    const uint32_t target = routeTargets[r];
+                    inPorts[target]->propagate(outPorts[p]);
+                    const uint32_t owner = inOwner[target];
+                    received[owner] = 1;
+                    if (scheduled[owner] == 0) {
+                        scheduled[owner] = 1;
+                        active.push_back(owner);
+                    }
+                }
+            }
+        }
+
+        void clearOutputs(uint32_t model) {
+            for (uint32_t p = outStart[model]; p < outStart[model + 1]; p++) {
+                outPorts[p]->clear();
+            }
+        }
+
+        // Simulates the events at the next event time
+        void step(double time) {
+            imminent.clear();
+            active.clear();
+            for (uint32_t m = 0; m < models.size(); m++) {
+                if (timeNext[m] == time) {
+                    imminent.push_back(m);
+                }
+            }
+            runOutputs(imminent);
+
+            if (constructorMessages) {
+                // Messages queued by the constructors are sent with the first outputs, from every model
+                for (uint32_t m = 0; m < models.size(); m++) {
+                    send(m);
+                }
+            } else {
+                for (const uint32_t m : imminent) {
+                    send(m);
+                }
+            }
+            for (const uint32_t m : imminent) {
+                if (scheduled[m] == 0) {
+                    scheduled[m] = 1;
+                    active.push_back(m);
+                }
+            }
+            std::sort(active.begin(), active.end());
+
+            runTransitions(time, active);
+            if (logger != nullptr) {
+                for (const uint32_t m : active) {
+                    const AtomicInterface& model = *models[m];
+                    for (uint32_t p = outStart[m]; p < outStart[m + 1]; p++) {
+                        for (std::size_t i = 0; i < outPorts[p]->size(); i++) {
+                            logger->logOutput(time, m, model.getId(), outPorts[p]->getId(), outPorts[p]->logMessage(i));
+                        }
+                    }
+                    logger->logState(time, m, model.getId(), model.logState());
+                }
+            }
+
+            if (constructorMessages) {
+                for (uint32_t m = 0; m < models.size(); m++) {
+                    clearOutputs(m);
+                }
+                constructorMessages = false;
+            } else {
+                for (const uint32_t m : imminent) {
+                    clearOutputs(m);
+                }
+            }
+            timeCurrent = time;
+        }
+
+        [[nodiscard]] double nextEventTime() const {
+            return timeNext.empty() ? std::numeric_limits<double>::infinity() : *std::min_element(timeNext.begin(), timeNext.end());
+        }
+
+        // Writes the times of the models back into their simulators and coordinators
+        void synchronize() {
+            for (std::size_t m = 0; m < models.size(); m++) {
+                TimeAccess::lastOf(*simulators[m]) = timeLast[m];
+                TimeAccess::nextOf(*simulators[m]) = timeNext[m];
+            }
+            for (const CoordinatorRange& range : coordinators) {
+                double last = timeCurrent;
+                double next = std::numeric_limits<double>::infinity();
+                for (uint32_t m = range.first; m < range.last; m++) {
+                    last = std::max(last, timeLast[m]);
+                    next = std::min(next, timeNext[m]);
+                }
+                TimeAccess::lastOf(*range.coordinator) = last;
+                TimeAccess::nextOf(*range.coordinator) = next;
+            }
+        }
+
+     protected:
+
+        /**
+         * Calls output() on the imminent models of a step, one after the other.
+         *
+         * @param imminent models whose next event time is the time of the step, in id order.
+         */
+        virtual void runOutputs(const std::vector<uint32_t>& imminent) {
+            for (const uint32_t m : imminent) {
+                outputOf(m);
+            }
+        }
+
+        /**
+         * Runs the transitions of a step, one after the other.
+         *
+         * @param time time of the step.
+         * @param active imminent models and models that received messages, in id order.
+         */
+        virtual void runTransitions(double time, const std::vector<uint32_t>& active) {
+            for (const uint32_t m : active) {
+                transitionOf(time, m);
+            }
+        }
+
+        // Calls the output function of a model, which only fills its own output ports
+        void outputOf(uint32_t m) {
+            models[m]->output();
+        }
+
+        // Runs the transition of a model, which only reads its own input ports, and sets its times
+        void transitionOf(double time, uint32_t m) {
+            AtomicInterface& model = *models[m];
+            if (received[m] == 0) {
+                model.internalTransition();
+            } else if (timeNext[m] == time) {
+                model.confluentTransition(time - timeLast[m]);
+            } else {
+                model.externalTransition(time - timeLast[m]);
+            }
+            timeLast[m] = time;
+            timeNext[m] = time + model.timeAdvance();
+            for (uint32_t p = inStart[m]; p < inStart[m + 1]; p++) {
+                inPorts[p]->clear();
+            }
+            received[m] = 0;
+            scheduled[m] = 0;
+        }
+
+     public:
+        explicit FlatRootCoordinator(std::shared_ptr<Coupled> model, double time = 0):
+            RootCoordinator(std::move(model), time), logger(), timeCurrent(time), constructorMessages(true) {}
+
+        virtual ~FlatRootCoordinator() = default;
+
+        template<typename T, typename... Args>
+        void setLogger(Args&&... args) {
+            logger = std::make_shared<T>(std::forward<Args>(args)...);
+        }
+
+        void start() {
+            RootCoordinator::start();
+            timeCurrent = getTopCoordinator()->getTimeLast();
+            flatten();
+            if (logger != nullptr) {
+                logger->start();
+                for (uint32_t m = 0; m < models.size(); m++) {
+                    logger->logState(timeLast[m], m, models[m]->getId(), models[m]->logState());
+                }
+            }
+        }
+
+        void stop() {
+            synchronize();
+            RootCoordinator::stop();
+            if (logger != nullptr) {
+                logger->stop();
+            }
+        }
+
+        /**
+         * Simulates the model for a given time.
+         *
+         * @param timeInterval simulated time; the events at the end of the interval are not simulated.
+         */
+        void simulate(double timeInterval) {
+            const double timeFinal = timeCurrent + timeInterval;
+            for (double time = nextEventTime(); time < timeFinal; time = nextEventTime()) {
+                step(time);
+            }
+            synchronize();
+        }
+
+        /**
+         * Simulates a given number of steps, or until every model is passive.
+         *
+         * @param iterations number of event times to simulate.
+         */
+        void simulate(long iterations) {
+            for (double time = nextEventTime(); iterations-- > 0 && time < std::numeric_limits<double>::infinity(); time = nextEventTime()) {
+                step(time);
+            }
+            synchronize();
+        }
+    };
+} // namespace cadmium
+
+#endif // __FLAT_ROOT_COORDINATOR_HPP__
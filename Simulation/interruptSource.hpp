@@ -0,0 +1,45 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Interface between the interrupt handlers of the input models and LowPowerRootCoordinator.
+ *
+ * An input model woken by an interrupt (a GPIO edge, the end of an ADC conversion)
+ * instead of polling on a fixed period derives from InterruptSource. It stays passive,
+ * and its interrupt handler:
+ *  - stores what it read in the model, so interruptPending() returns true
+ *  - calls requestWake(), so the clock stops sleeping and returns to the coordinator
+ * LowPowerRootCoordinator then makes the model imminent at the time it woke up, and
+ * the model sends what it read with its next output() like any other event.
+ */
+
+#ifndef __INTERRUPT_SOURCE_HPP__
+#define __INTERRUPT_SOURCE_HPP__
+
+namespace cadmium {
+
+    // Set by the interrupt handlers of the input models, cleared by the clock when it wakes up
+    inline volatile bool wakeRequested = false;
+
+    /**
+     * Asks the clock to return to the coordinator instead of sleeping again.
+     * Called from the interrupt handlers of the input models.
+     */
+    inline void requestWake() {
+        wakeRequested = true;
+    }
+
+    class InterruptSource {
+     public:
+        virtual ~InterruptSource() = default;
+
+        /**
+         * Tells if an interrupt left an input the model has not sent yet.
+         *
+         * @return true if the model has to be made imminent.
+         */
+        [[nodiscard]] virtual bool interruptPending() const = 0;
+    };
+} // namespace cadmium
+
+#endif // __INTERRUPT_SOURCE_HPP__
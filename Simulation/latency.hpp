@@ -0,0 +1,182 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Response time probes for the real-time examples, compiled only with LATENCY_PROBES.
+ *
+ * A LatencySpan measures the wall-clock time between two points of the models, e.g.
+ * from the controller receiving the submit button to the LED command leaving
+ * garageDoor. Timestamps are read from the DWT cycle counter of the Cortex-M4 on the
+ * MSP432 (EMBED), and from std::chrono::steady_clock on the desktop (see
+ * cycleCounter.hpp). Each span aggregates its durations in place, with no
+ * allocation, into a LatencyHistogram: count, min, max, mean, and power-of-two
+ * buckets of microseconds. printLatencyReport() prints every span with printf,
+ * i.e. over the UART on the MSP432 (see ProbeReporter for a periodic report).
+ *
+ * Models only use the macros, which expand to nothing without LATENCY_PROBES:
+ *     LATENCY_SPAN(submitToLed);               // at namespace scope, in a header shared by the models
+ *     LATENCY_START(submitToLed);              // starts (or restarts) the span
+ *     LATENCY_STOP(submitToLed);               // records the time since the start, if started
+ *     LATENCY_JITTER(phaseChange, 6.0);        // records how far the time since the start is from 6 s, then restarts
+ *
+ * The input-to-actuator spans of the examples are taken by the LatencyProbe models of
+ * Shared_Models/latencyProbes.hpp, coupled to the ports of the input and output models,
+ * which also give the simulated time of each end. A span started and stopped at
+ * simulated times records its wall time minus the wall time the models spend waiting
+ * between them (the simulated time elapsed times latencyModeledScale), so a door
+ * modeled to close in 2 s only adds the processing of the events on the way:
+ *  - on the MSP432 the simulated time runs with the wall time, latencyModeledScale is 1
+ *  - on the desktop the simulation does not wait, latencyModeledScale is 0, unless it
+ *    runs in real time (--realtime X sets it to 1 / X, see Simulation/runner.hpp)
+ * On the MSP432 the cycle counter wraps after about 89 s, so longer spans are not
+ * measured correctly.
+ */
+
+#ifndef __LATENCY_HPP__
+#define __LATENCY_HPP__
+
+#ifdef LATENCY_PROBES
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "cycleCounter.hpp"
+
+namespace cadmium {
+
+    // Wall seconds per simulated second, subtracted from the spans started at a simulated time
+#ifdef EMBED
+    inline double latencyModeledScale = 1;
+#else
+    inline double latencyModeledScale = 0;
+#endif
+
+    class LatencyHistogram {
+     public:
+        static constexpr std::size_t BUCKETS = 32; // Bucket n holds durations below 2^n us, and at or above 2^(n-1) us
+
+        uint32_t count;
+        uint32_t min;
+        uint32_t max;
+        uint64_t total;
+        uint32_t buckets[BUCKETS];
+
+        LatencyHistogram(): count(0), min(UINT32_MAX), max(0), total(0), buckets() {}
+
+        /**
+         * Adds a duration.
+         *
+         * @param microseconds duration, in microseconds.
+         */
+        void add(uint32_t microseconds) {
+            std::size_t bucket = 0;
+            while (bucket + 1 < BUCKETS && (microseconds >> bucket) != 0) {
+                bucket++;
+            }
+            buckets[bucket]++;
+            count++;
+            total += microseconds;
+            min = microseconds < min ? microseconds : min;
+            max = microseconds > max ? microseconds : max;
+        }
+    };
+
+    class LatencySpan {
+        static inline LatencySpan* first = nullptr; // Every span, for printLatencyReport()
+
+        CycleTicks started;
+        double startedTime; // Simulated time of the start
+        bool running;
+
+     public:
+        const char* const name;
+        LatencyHistogram histogram;
+        LatencySpan* const next;
+
+        explicit LatencySpan(const char* name): started(0), startedTime(0), running(false), name(name), histogram(), next(first) {
+            first = this;
+            startCycleCounter();
+        }
+
+        static LatencySpan* all() {
+            return first;
+        }
+
+        /**
+         * Starts (or restarts) the span.
+         *
+         * @param time simulated time of the start, for the spans ending at a later simulated time.
+         */
+        void start(double time = 0) {
+            started = cycleNow();
+            startedTime = time;
+            running = true;
+        }
+
+        /**
+         * Records the time since the start, if started, without the time modeled in between.
+         *
+         * @param time simulated time of the stop.
+         */
+        void stop(double time = 0) {
+            if (running) {
+                const double modeled = (time - startedTime) * latencyModeledScale * 1e6;
+                const double elapsed = static_cast<double>(cycleMicroseconds(cycleNow() - started)) - modeled;
+                histogram.add(elapsed <= 0 ? 0 : (elapsed < UINT32_MAX ? static_cast<uint32_t>(elapsed) : UINT32_MAX));
+                running = false;
+            }
+        }
+
+        /**
+         * Records how far the time since the start is from a nominal duration, then restarts.
+         *
+         * @param nominal expected time since the start, in seconds.
+         */
+        void jitter(double nominal) {
+            const CycleTicks now = cycleNow();
+            if (running) {
+                const double elapsed = static_cast<double>(cycleMicroseconds(now - started));
+                const double deviation = elapsed > nominal * 1e6 ? elapsed - nominal * 1e6 : nominal * 1e6 - elapsed;
+                histogram.add(deviation < UINT32_MAX ? static_cast<uint32_t>(deviation) : UINT32_MAX);
+            }
+            started = now;
+            running = true;
+        }
+    };
+
+    /**
+     * Prints the histogram of every span, skipping the empty buckets.
+     */
+    inline void printLatencyReport() {
+        for (const LatencySpan* span = LatencySpan::all(); span != nullptr; span = span->next) {
+            const LatencyHistogram& histogram = span->histogram;
+            if (histogram.count == 0) {
+                std::printf("latency %s: no samples\n", span->name);
+                continue;
+            }
+            std::printf("latency %s: count %lu, min %lu us, max %lu us, mean %lu us\n", span->name,
+                        static_cast<unsigned long>(histogram.count), static_cast<unsigned long>(histogram.min),
+                        static_cast<unsigned long>(histogram.max),
+                        static_cast<unsigned long>(histogram.total / histogram.count));
+            for (std::size_t i = 0; i < LatencyHistogram::BUCKETS; i++) {
+                if (histogram.buckets[i] != 0) {
+                    std::printf("  < %lu us: %lu\n", 1ul << i, static_cast<unsigned long>(histogram.buckets[i]));
+                }
+            }
+        }
+    }
+} // namespace cadmium
+
+    #define LATENCY_SPAN(span) inline ::cadmium::LatencySpan span(#span)
+    #define LATENCY_START(span) (span).start()
+    #define LATENCY_STOP(span) (span).stop()
+    #define LATENCY_JITTER(span, nominal) (span).jitter(nominal)
+#else
+    #define LATENCY_SPAN(span) static_assert(true, "")
+    #define LATENCY_START(span) ((void)0)
+    #define LATENCY_STOP(span) ((void)0)
+    #define LATENCY_JITTER(span, nominal) ((void)0)
+#endif // LATENCY_PROBES
+
+#endif // __LATENCY_HPP__
@@ -0,0 +1,170 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Real-time clock of the MSP432 sleeping in a low-power mode while it waits (EMBED only).
+ *
+ * TIClock waits for the next event by reading its timer in a loop, so the CPU runs at
+ * full speed between events. LowPowerClock<Mode> keeps time with Timer_A3, clocked by
+ * ACLK from the 32768 Hz REFO, which keeps counting in LPM0 and LPM3. To wait, it sets
+ * a compare on Timer_A3 at the time of the next event and sleeps:
+ *  - SleepMode::LPM0 only stops the CPU. The ADC, the PWM of Timer_A0 and the SPI of
+ *    the LCD keep their clocks, so the temperature sensor and the buzzer still work.
+ *  - SleepMode::LPM3 also stops MCLK and SMCLK, and uses much less power, but only
+ *    the GPIO interrupts and the timers on ACLK can wake the board.
+ * Any enabled interrupt wakes the CPU. The clock goes back to sleep unless the next
+ * event is due or an input model called requestWake(), see interruptSource.hpp. With
+ * an infinite timeNext (all models passive) it sleeps until such an interrupt, waking
+ * up only every 2 s to count the laps of the 16-bit timer.
+ *
+ * Times have a resolution of 1/32768 s (about 31 us). Use it with LowPowerRootCoordinator,
+ * on its own or wrapped by DrainingClock.
+ */
+
+#ifndef __LOW_POWER_CLOCK_HPP__
+#define __LOW_POWER_CLOCK_HPP__
+
+#include <simulation/rt_clock/rt_clock.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <msp.h>
+#include <cs.h>
+#include <interrupt.h>
+#include <pcm.h>
+#include <timer_a.h>
+
+#include "interruptSource.hpp"
+#include "sleepMode.hpp"
+
+namespace cadmium {
+
+    // Laps of the 16-bit counter of Timer_A3, counted by TA3_N_IRQHandler
+    inline volatile uint32_t lowPowerTimerLaps = 0;
+
+    template<SleepMode Mode = SleepMode::LPM3>
+    class LowPowerClock : public RealTimeClock {
+        static constexpr double TICKS_PER_SECOND = 32768.0;
+        static constexpr uint64_t MIN_SLEEP_TICKS = 2; // Closer events are waited for without sleeping
+
+        double startTime;    // Simulation time when the clock started
+        uint64_t startTicks; // Timer_A3 ticks when the clock started
+        bool lpm3Refused;    // PCM refused LPM3 once, LPM0 is used instead
+
+        /**
+         * Reads the ticks counted since reset. Must be called with interrupts disabled.
+         *
+         * @return ticks of Timer_A3, including its laps.
+         */
+        static uint64_t ticks() {
+            uint32_t laps = lowPowerTimerLaps;
+            const uint16_t counter = Timer_A_getCounterValue(TIMER_A3_BASE);
+            // The counter wrapped since interrupts were disabled, TA3_N_IRQHandler has not counted it yet
+            if (Timer_A_getInterruptStatus(TIMER_A3_BASE) == TIMER_A_INTERRUPT_PENDING && counter < 0x8000) {
+                laps++;
+            }
+            return (static_cast<uint64_t>(laps) << 16) | counter;
+        }
+
+        [[nodiscard]] double timeAt(uint64_t tick) const {
+            return startTime + static_cast<double>(tick - startTicks) / TICKS_PER_SECOND;
+        }
+
+        [[nodiscard]] uint64_t tickAt(double time) const {
+            return startTicks + static_cast<uint64_t>(std::ceil((time - startTime) * TICKS_PER_SECOND));
+        }
+
+        void sleep() {
+            if (Mode == SleepMode::LPM3 && !lpm3Refused) {
+                lpm3Refused = !PCM_gotoLPM3InterruptSafe();
+            } else {
+                PCM_gotoLPM0InterruptSafe();
+            }
+        }
+
+     public:
+        LowPowerClock(): RealTimeClock(), startTime(0), startTicks(0), lpm3Refused(false) {}
+
+        /**
+         * Starts Timer_A3 in continuous mode on ACLK.
+         *
+         * @param timeLast simulation time when the simulation starts.
+         */
+        void start(double timeLast) override {
+            RealTimeClock::start(timeLast);
+            CS_setReferenceOscillatorFrequency(CS_REFO_32KHZ);
+            CS_initClockSignal(CS_ACLK, CS_REFOCLK_SELECT, CS_CLOCK_DIVIDER_1);
+
+            const Timer_A_ContinuousModeConfig config = {
+                TIMER_A_CLOCKSOURCE_ACLK,
+                TIMER_A_CLOCKSOURCE_DIVIDER_1,
+                TIMER_A_TAIE_INTERRUPT_ENABLE,
+                TIMER_A_DO_CLEAR
+            };
+            lowPowerTimerLaps = 0;
+            Timer_A_configureContinuousMode(TIMER_A3_BASE, &config);
+            Interrupt_enableInterrupt(INT_TA3_0);
+            Interrupt_enableInterrupt(INT_TA3_N);
+            Interrupt_enableMaster();
+            startTicks = 0;
+            startTime = timeLast;
+            Timer_A_startCounter(TIMER_A3_BASE, TIMER_A_CONTINUOUS_MODE);
+        }
+
+        void stop(double timeLast) override {
+            Timer_A_stopTimer(TIMER_A3_BASE);
+            RealTimeClock::stop(timeLast);
+        }
+
+        /**
+         * Sleeps until the next event, or until an input model requests a wake up.
+         *
+         * @param timeNext simulation time of the next event, can be infinity.
+         * @return timeNext, or the earlier time at which an input model requested a wake up.
+         */
+        double waitUntil(double timeNext) override {
+            const bool scheduled = timeNext < std::numeric_limits<double>::infinity();
+            const uint64_t target = scheduled ? tickAt(timeNext) : std::numeric_limits<uint64_t>::max();
+            while (true) {
+                // Interrupts stay disabled from the checks until the CPU sleeps, so a wake up cannot be missed
+                Interrupt_disableMaster();
+                const uint64_t now = ticks();
+                if (wakeRequested) {
+                    wakeRequested = false;
+                    Interrupt_enableMaster();
+                    return scheduled ? std::min(timeAt(now), timeNext) : timeAt(now);
+                }
+                if (now >= target) {
+                    Interrupt_enableMaster();
+                    return timeNext;
+                }
+                if (target - now <= MIN_SLEEP_TICKS) {
+                    Interrupt_enableMaster();
+                    continue;
+                }
+                if (target - now < 0x10000) {
+                    // Events more than a lap away are reached after the overflow interrupts woke the CPU
+                    Timer_A_setCompareValue(TIMER_A3_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0, static_cast<uint16_t>(target));
+                    Timer_A_clearCaptureCompareInterrupt(TIMER_A3_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+                    Timer_A_enableCaptureCompareInterrupt(TIMER_A3_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+                }
+                sleep(); // Enables interrupts again once woken up
+            }
+        }
+    };
+} // namespace cadmium
+
+// Compare of Timer_A3 reached, the CPU wakes up for the next event
+extern "C" void TA3_0_IRQHandler(void) {
+    Timer_A_clearCaptureCompareInterrupt(TIMER_A3_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+    Timer_A_disableCaptureCompareInterrupt(TIMER_A3_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+}
+
+// Counter of Timer_A3 wrapped
+extern "C" void TA3_N_IRQHandler(void) {
+    Timer_A_clearInterruptFlag(TIMER_A3_BASE);
+    cadmium::lowPowerTimerLaps = cadmium::lowPowerTimerLaps + 1;
+}
+
+#endif // __LOW_POWER_CLOCK_HPP__
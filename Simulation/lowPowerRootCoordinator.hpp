@@ -0,0 +1,125 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Root coordinator sleeping between events, used instead of RealTimeRootCoordinator
+ * on the battery-powered boards.
+ *
+ * RootCoordinator::simulate() stops as soon as every model is passive, and Cadmium only
+ * works out the next event of a model after one of its transitions. So a passive model
+ * cannot be woken by an interrupt. LowPowerRootCoordinator<Clock> runs the loop itself:
+ *  - it asks the clock to wait until the next event, with an infinite time when all
+ *    models are passive (LowPowerClock then sleeps until an interrupt)
+ *  - when the clock returns early because an input model called requestWake(), every
+ *    InterruptSource with an interrupt pending has its next event moved to the time the
+ *    clock woke up, in its simulator and in the coordinators above it
+ *  - it then runs one step of the simulation, with RootCoordinator::simulate(1L)
+ * The clock is a RealTimeClock like those of RealTimeRootCoordinator, so it can be
+ * wrapped by DrainingClock. Models that do not derive from InterruptSource are
+ * simulated as with RealTimeRootCoordinator.
+ */
+
+#ifndef __LOW_POWER_ROOT_COORDINATOR_HPP__
+#define __LOW_POWER_ROOT_COORDINATOR_HPP__
+
+#include <simulation/root_coordinator.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "interruptSource.hpp"
+
+namespace cadmium {
+
+    template<typename Clock>
+    class LowPowerRootCoordinator : public RootCoordinator {
+
+        // Input model woken by interrupts, with its simulator then the coordinators above it
+        struct Source {
+            const InterruptSource* model;
+            std::vector<AbstractSimulator*> simulators;
+        };
+
+        // Gives access to the protected next event time of a simulator
+        struct NextEventAccess : AbstractSimulator {
+            static double& of(AbstractSimulator& simulator) {
+                return simulator.*(&NextEventAccess::timeNext);
+            }
+        };
+
+        Clock clock;
+        std::vector<Source> sources;
+
+        void collect(const std::shared_ptr<AbstractSimulator>& simulator, std::vector<AbstractSimulator*> above) {
+            above.insert(above.begin(), simulator.get());
+            if (auto coordinator = std::dynamic_pointer_cast<Coordinator>(simulator)) {
+                for (const auto& sub : coordinator->getSubcomponents()) {
+                    collect(sub, above);
+                }
+            } else if (auto* source = dynamic_cast<const InterruptSource*>(simulator->getComponent().get())) {
+                sources.push_back({source, above});
+            }
+        }
+
+        /**
+         * Makes the input models with an interrupt pending imminent.
+         *
+         * @param time time the clock woke up at.
+         */
+        void wakeSources(double time) {
+            for (const auto& source : sources) {
+                if (!source.model->interruptPending()) {
+                    continue;
+                }
+                for (auto* simulator : source.simulators) {
+                    double& timeNext = NextEventAccess::of(*simulator);
+                    timeNext = std::min(timeNext, time);
+                }
+            }
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param model top model.
+         * @param clock real-time clock used to wait for the next event.
+         */
+        LowPowerRootCoordinator(std::shared_ptr<Coupled> model, Clock clock):
+            RootCoordinator(std::move(model)), clock(clock), sources() {
+            collect(getTopCoordinator(), {});
+        }
+
+        void start() {
+            clock.start(getTopCoordinator()->getTimeLast());
+            RootCoordinator::start();
+        }
+
+        void stop() {
+            RootCoordinator::stop();
+            clock.stop(getTopCoordinator()->getTimeLast());
+        }
+
+        /**
+         * Simulates the model in real time, sleeping between events.
+         *
+         * @param timeInterval simulated time, can be infinity to run for ever.
+         */
+        void simulate(double timeInterval) {
+            const double timeFinal = getTopCoordinator()->getTimeLast() + timeInterval;
+            while (true) {
+                const double timeNext = std::min(getTopCoordinator()->getTimeNext(), timeFinal);
+                const double timeReached = clock.waitUntil(timeNext);
+                if (timeReached >= timeFinal) {
+                    break;
+                }
+                wakeSources(timeReached);
+                if (getTopCoordinator()->getTimeNext() <= timeReached) {
+                    RootCoordinator::simulate(1L);
+                }
+            }
+        }
+    };
+} // namespace cadmium
+
+#endif // __LOW_POWER_ROOT_COORDINATOR_HPP__
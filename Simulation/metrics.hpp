@@ -0,0 +1,258 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Online metrics of the examples, compiled only with ONLINE_METRICS.
+ *
+ * The KPIs of a run are aggregated while it simulates, with no log to write and parse
+ * afterwards, so they are also available with --log none, NO_LOGGING or on the MSP432:
+ *  - MetricSummary: count, total, min, max and mean of samples (e.g. a wait time in
+ *    simulated seconds), and their 50th, 90th and 99th percentiles, estimated from a
+ *    histogram of 4 buckets per power of two (within 12.5 % of the exact value)
+ *  - MetricRatio: how many of the events counted were hits (e.g. accepted passwords)
+ * Each metric aggregates in place, with no allocation. printMetricsReport() prints
+ * every metric with printf, i.e. over the UART on the MSP432 (see ProbeReporter for a
+ * periodic report); the desktop runner prints it once the simulation stopped.
+ *
+ * Models push samples with the macros, which expand to nothing without ONLINE_METRICS:
+ *     METRIC_SUMMARY(elevatorWait, "s");   // at namespace scope, in a header shared by the models
+ *     METRIC_RATIO(lockAuthorized);
+ *     METRIC_SAMPLE(elevatorWait, 4.2);    // adds a sample
+ *     METRIC_HIT(lockAuthorized, matched); // counts an event, a hit if matched
+ * Models do not know the simulated time, so the KPIs measured in time are taken by the
+ * observer models of Shared_Models/metricObservers.hpp, coupled to the ports of the
+ * models. An observer opens a MetricSummary when an episode starts and closes it when
+ * it ends; the episode still open when the report is printed is counted up to then.
+ *
+ * The metrics are global, like the latency spans, so a process measures one simulation
+ * at a time (a benchmark or a sweep would add up the samples of all its runs). They are
+ * not saved in a checkpoint (see Simulation/checkpoint.hpp): a resumed run only counts
+ * the episodes ending after the checkpoint, but the observers keep the start of the
+ * episodes open in their state, so these are counted from their start.
+ */
+
+#ifndef __METRICS_HPP__
+#define __METRICS_HPP__
+
+#ifdef ONLINE_METRICS
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace cadmium {
+
+    // Samples aggregated by a MetricSummary
+    struct MetricStats {
+        static constexpr double BASE = 1e-3;        // Bucket 0 holds the samples up to BASE
+        static constexpr std::size_t OCTAVES = 24;  // Powers of two above BASE with buckets, up to about 4.6 h in seconds
+        static constexpr std::size_t STEPS = 4;     // Buckets per power of two
+        static constexpr std::size_t BUCKETS = 1 + OCTAVES * STEPS;
+
+        uint32_t count;
+        double total;
+        double min;
+        double max;
+        uint32_t buckets[BUCKETS]; // Bucket i > 0 holds BASE * 2^o * (1 + s / STEPS) up to the next one, i = 1 + o * STEPS + s
+
+        MetricStats(): count(0), total(0), min(0), max(0), buckets() {}
+
+        void add(double value) {
+            std::size_t bucket = 0;
+            if (value > BASE) {
+                int exponent = 0;
+                const double mantissa = std::frexp(value / BASE, &exponent); // value / BASE = mantissa * 2^exponent, mantissa in [0.5, 1)
+                const auto step = static_cast<std::size_t>((2 * mantissa - 1) * STEPS);
+                bucket = 1 + static_cast<std::size_t>(exponent - 1) * STEPS + (step < STEPS ? step : STEPS - 1);
+                bucket = bucket < BUCKETS ? bucket : BUCKETS - 1;
+            }
+            buckets[bucket]++;
+            min = count == 0 || value < min ? value : min;
+            max = count == 0 || value > max ? value : max;
+            count++;
+            total += value;
+        }
+
+        /**
+         * Estimates a percentile from the histogram.
+         *
+         * @param fraction fraction of the samples at or below the percentile, e.g. 0.9.
+         * @return middle of the bucket holding the percentile, within min and max; 0 without samples.
+         */
+        [[nodiscard]] double quantile(double fraction) const {
+            if (count == 0) {
+                return 0;
+            }
+            const auto rank = static_cast<uint32_t>(std::ceil(fraction * count));
+            uint32_t seen = 0;
+            std::size_t bucket = 0;
+            while (bucket + 1 < BUCKETS && seen + buckets[bucket] < (rank > 0 ? rank : 1)) {
+                seen += buckets[bucket];
+                bucket++;
+            }
+            double estimate = BASE / 2;
+            if (bucket > 0) {
+                const std::size_t octave = (bucket - 1) / STEPS;
+                const std::size_t step = (bucket - 1) % STEPS;
+                estimate = std::ldexp(BASE, static_cast<int>(octave)) * (1 + (step + 0.5) / STEPS);
+            }
+            return estimate < min ? min : (estimate > max ? max : estimate);
+        }
+    };
+
+    class Metric {
+        static inline Metric* first = nullptr; // Every metric, for printMetricsReport()
+
+     public:
+        const char* const name;
+        Metric* const next;
+
+        explicit Metric(const char* name): name(name), next(first) {
+            first = this;
+        }
+
+        virtual ~Metric() = default;
+
+        static Metric* all() {
+            return first;
+        }
+
+        /**
+         * Prints the metric.
+         *
+         * @param now simulated time of the report, closing the open episodes.
+         */
+        virtual void print(double now) const = 0;
+
+     protected:
+        // Prints a value with 3 decimals (up to about 4.3e6), as the printf of the MSP432 has no floating point support
+        static void printValue(double value) {
+            const double rounded = std::round((value < 0 ? -value : value) * 1000);
+            const auto thousandths = static_cast<unsigned long>(rounded < UINT32_MAX ? rounded : UINT32_MAX);
+            std::printf("%s%lu.%03lu", value < 0 ? "-" : "", thousandths / 1000, thousandths % 1000);
+        }
+    };
+
+    class MetricSummary : public Metric {
+        MetricStats stats;
+        double openedAt; // Start of the open episode, negative if none is open
+
+     public:
+        const char* const unit;
+
+        MetricSummary(const char* name, const char* unit): Metric(name), stats(), openedAt(-1), unit(unit) {}
+
+        void add(double value) {
+            stats.add(value);
+        }
+
+        /**
+         * Starts an episode, closing the one open.
+         *
+         * @param time simulated time the episode starts at.
+         */
+        void open(double time) {
+            close(time);
+            openedAt = time;
+        }
+
+        /**
+         * Ends the open episode, adding its duration as a sample. Does nothing without one.
+         *
+         * @param time simulated time the episode ends at.
+         */
+        void close(double time) {
+            if (openedAt >= 0) {
+                stats.add(time - openedAt);
+                openedAt = -1;
+            }
+        }
+
+        [[nodiscard]] bool isOpen() const {
+            return openedAt >= 0;
+        }
+
+        /**
+         * Sets the open episode of a run resumed from a checkpoint, without adding a sample.
+         *
+         * @param time simulated time the open episode started at, negative if none is open.
+         */
+        void resume(double time) {
+            openedAt = time;
+        }
+
+        void print(double now) const override {
+            MetricStats shown = stats;
+            if (openedAt >= 0 && std::isfinite(now) && now >= openedAt) {
+                shown.add(now - openedAt);
+            }
+            if (shown.count == 0) {
+                std::printf("metric %s: no samples\n", name);
+                return;
+            }
+            std::printf("metric %s: count %lu, total ", name, static_cast<unsigned long>(shown.count));
+            printValue(shown.total);
+            std::printf(" %s, mean ", unit);
+            printValue(shown.total / shown.count);
+            std::printf(", min ");
+            printValue(shown.min);
+            std::printf(", p50 ");
+            printValue(shown.quantile(0.5));
+            std::printf(", p90 ");
+            printValue(shown.quantile(0.9));
+            std::printf(", p99 ");
+            printValue(shown.quantile(0.99));
+            std::printf(", max ");
+            printValue(shown.max);
+            std::printf(" %s%s\n", unit, openedAt >= 0 ? " (last one still open)" : "");
+        }
+    };
+
+    class MetricRatio : public Metric {
+        uint32_t hits;
+        uint32_t total;
+
+     public:
+        explicit MetricRatio(const char* name): Metric(name), hits(0), total(0) {}
+
+        void add(bool hit) {
+            hits += hit ? 1 : 0;
+            total++;
+        }
+
+        void print(double) const override {
+            if (total == 0) {
+                std::printf("metric %s: no samples\n", name);
+                return;
+            }
+            std::printf("metric %s: %lu of %lu (", name, static_cast<unsigned long>(hits), static_cast<unsigned long>(total));
+            printValue(100.0 * hits / total);
+            std::printf(" %%)\n");
+        }
+    };
+
+    /**
+     * Prints every metric.
+     *
+     * @param now simulated time of the report; the episodes still open are counted up to it.
+     */
+    inline void printMetricsReport(double now) {
+        for (const Metric* metric = Metric::all(); metric != nullptr; metric = metric->next) {
+            metric->print(now);
+        }
+    }
+} // namespace cadmium
+
+    #define METRIC_SUMMARY(metric, unit) inline ::cadmium::MetricSummary metric(#metric, unit)
+    #define METRIC_RATIO(metric) inline ::cadmium::MetricRatio metric(#metric)
+    #define METRIC_SAMPLE(metric, value) (metric).add(value)
+    #define METRIC_HIT(metric, hit) (metric).add(hit)
+#else
+    #define METRIC_SUMMARY(metric, unit) static_assert(true, "")
+    #define METRIC_RATIO(metric) static_assert(true, "")
+    #define METRIC_SAMPLE(metric, value) ((void)0)
+    #define METRIC_HIT(metric, hit) ((void)0)
+#endif // ONLINE_METRICS
+
+#endif // __METRICS_HPP__
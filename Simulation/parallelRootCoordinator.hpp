@@ -0,0 +1,179 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Root coordinator running the models of a step on several threads (desktop only).
+ *
+ * ParallelRootCoordinator simulates the flattened model of FlatRootCoordinator, and
+ * runs on a pool of threads:
+ *  - the output functions of the models imminent at the same time
+ *  - then the transitions of those models and of the models they sent messages to
+ * Each model only reads its own input ports and writes its own state and output
+ * ports, so the models of a step do not depend on each other. Messages are routed
+ * and logged by the calling thread, in the order of the model ids, once the models
+ * of the step are done. The logs and the results are then identical to those of
+ * FlatRootCoordinator, whatever the number of threads.
+ *
+ * Steps with fewer than minParallelModels models are run by the calling thread
+ * alone, as waking the pool costs more than a few transitions. With LATENCY_PROBES
+ * every step is run by the calling thread, as the spans are shared between models.
+ *
+ *     auto rootCoordinator = cadmium::ParallelRootCoordinator(model, 8);
+ */
+
+#ifndef __PARALLEL_ROOT_COORDINATOR_HPP__
+#define __PARALLEL_ROOT_COORDINATOR_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "flatRootCoordinator.hpp"
+
+namespace cadmium {
+
+    class ParallelRootCoordinator : public FlatRootCoordinator {
+        static constexpr std::size_t CHUNK = 8; // Models taken at once by a thread
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        uint64_t batch;       // Incremented for every batch given to the workers
+        std::size_t busy;     // Workers still running the current batch
+        bool stopping;
+
+        const std::vector<uint32_t>* items;
+        std::function<void(uint32_t)> task;
+        std::atomic<std::size_t> next;
+        std::exception_ptr failure;
+        const std::size_t minParallelModels;
+
+        // Runs the task on the items not taken yet by another thread
+        void work() {
+            try {
+                for (std::size_t first = next.fetch_add(CHUNK); first < items->size(); first = next.fetch_add(CHUNK)) {
+                    const std::size_t last = std::min(first + CHUNK, items->size());
+                    for (std::size_t i = first; i < last; i++) {
+                        task((*items)[i]);
+                    }
+                }
+            } catch (...) {
+                const std::lock_guard<std::mutex> lock(mutex);
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        }
+
+        void worker() {
+            uint64_t seen = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [this, seen]() { return stopping || batch != seen; });
+                    if (stopping) {
+                        return;
+                    }
+                    seen = batch;
+                }
+                work();
+                {
+                    const std::lock_guard<std::mutex> lock(mutex);
+                    if (--busy == 0) {
+                        done.notify_one();
+                    }
+                }
+            }
+        }
+
+        /**
+         * Runs a task on every item of a list, on the pool and the calling thread.
+         *
+         * @param list models of the step.
+         * @param function function run on each model, which must only touch that model.
+         */
+        void runAll(const std::vector<uint32_t>& list, std::function<void(uint32_t)> function) {
+#ifndef LATENCY_PROBES
+            if (!workers.empty() && list.size() >= minParallelModels) {
+                items = &list;
+                task = std::move(function);
+                next = 0;
+                {
+                    const std::lock_guard<std::mutex> lock(mutex);
+                    busy = workers.size();
+                    batch++;
+                }
+                wake.notify_all();
+                work();
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    done.wait(lock, [this]() { return busy == 0; });
+                }
+                if (failure) {
+                    std::rethrow_exception(std::exchange(failure, nullptr));
+                }
+                return;
+            }
+#endif
+            for (const uint32_t m : list) {
+                function(m);
+            }
+        }
+
+     protected:
+        void runOutputs(const std::vector<uint32_t>& imminent) override {
+            runAll(imminent, [this](uint32_t m) { outputOf(m); });
+        }
+
+        void runTransitions(double time, const std::vector<uint32_t>& active) override {
+            runAll(active, [this, time](uint32_t m) { transitionOf(time, m); });
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param model top model.
+         * @param threads number of threads running the models, including the calling thread; 0 for one per hardware thread.
+         * @param time initial simulation time.
+         * @param minParallelModels number of models a step needs to be run on several threads.
+         */
+        explicit ParallelRootCoordinator(std::shared_ptr<Coupled> model, unsigned threads = 0, double time = 0,
+                                         std::size_t minParallelModels = 16):
+            FlatRootCoordinator(std::move(model), time), batch(0), busy(0), stopping(false), items(nullptr), next(0),
+            minParallelModels(std::max<std::size_t>(minParallelModels, 1)) {
+            if (threads == 0) {
+                threads = std::max(1U, std::thread::hardware_concurrency());
+            }
+            for (unsigned t = 1; t < threads; t++) {
+                workers.emplace_back([this]() { worker(); });
+            }
+        }
+
+        ParallelRootCoordinator(const ParallelRootCoordinator&) = delete;
+        ParallelRootCoordinator& operator=(const ParallelRootCoordinator&) = delete;
+
+        ~ParallelRootCoordinator() override {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto& thread : workers) {
+                thread.join();
+            }
+        }
+    };
+} // namespace cadmium
+
+#endif // __PARALLEL_ROOT_COORDINATOR_HPP__
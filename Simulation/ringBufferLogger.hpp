@@ -0,0 +1,177 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * RingBufferLogger is a replacement for STDOUTLogger in embedded builds. It writes
+ * the same lines as STDOUTLogger ("time;model_id;model_name;port_name;data"), but
+ * instead of printing them right away it copies them into a fixed-size ring buffer
+ * in SRAM and returns. DrainingClock (drainingClock.hpp) prints the queued lines
+ * while the real-time clock waits for the next event, so logging no longer delays
+ * transitions.
+ *
+ * When a line does not fit in the buffer it is dropped instead of blocking. The
+ * number of dropped lines is counted, and a "log records dropped" line is queued
+ * as soon as there is room for it again.
+ *
+ * The logger and the clock run in the same simulation loop, so the buffer is never
+ * accessed concurrently and needs no locking.
+ */
+
+#ifndef __RING_BUFFER_LOGGER_HPP__
+#define __RING_BUFFER_LOGGER_HPP__
+
+#include <simulation/logger/logger.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace cadmium {
+
+    class LogRingBuffer {
+        char* data;
+        std::size_t capacity;
+        std::size_t head;   // Index of the next byte to be printed
+        std::size_t length; // Number of bytes waiting to be printed
+        uint32_t dropped;   // Records dropped since the start of the simulation
+        uint32_t reported;  // Dropped records already reported in the log
+
+        void copy(const char* bytes, std::size_t n) {
+            std::size_t tail = (head + length) % capacity;
+            const std::size_t first = n < capacity - tail ? n : capacity - tail;
+            std::memcpy(data + tail, bytes, first);
+            std::memcpy(data, bytes + first, n - first);
+            length += n;
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param storage memory used for the buffer, usually a static array.
+         * @param capacity size of storage in bytes.
+         */
+        LogRingBuffer(char* storage, std::size_t capacity):
+            data(storage), capacity(capacity), head(0), length(0), dropped(0), reported(0) {}
+
+        /**
+         * Queues one record made of several pieces, or drops it if it does not fit.
+         *
+         * @param pieces text of the record, printed one after the other.
+         * @param count number of pieces.
+         * @return true if the record was queued.
+         */
+        bool push(const std::pair<const char*, std::size_t>* pieces, std::size_t count) {
+            if (dropped != reported) {
+                char notice[48];
+                const int n = std::snprintf(notice, sizeof(notice), "%lu log records dropped\n",
+                                            static_cast<unsigned long>(dropped - reported));
+                if (n <= 0 || static_cast<std::size_t>(n) > capacity - length) {
+                    dropped++;
+                    return false;
+                }
+                copy(notice, static_cast<std::size_t>(n));
+                reported = dropped;
+            }
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                total += pieces[i].second;
+            }
+            if (total > capacity - length) {
+                dropped++;
+                return false;
+            }
+            for (std::size_t i = 0; i < count; i++) {
+                copy(pieces[i].first, pieces[i].second);
+            }
+            return true;
+        }
+
+        /**
+         * Prints queued bytes to STDOUT.
+         *
+         * @param maxBytes maximum number of bytes to print in this call.
+         * @return number of bytes printed.
+         */
+        std::size_t drain(std::size_t maxBytes) {
+            std::size_t printed = 0;
+            while (length > 0 && printed < maxBytes) {
+                std::size_t n = capacity - head < length ? capacity - head : length;
+                if (n > maxBytes - printed) {
+                    n = maxBytes - printed;
+                }
+                std::fwrite(data + head, 1, n, stdout);
+                head = (head + n) % capacity;
+                length -= n;
+                printed += n;
+            }
+            if (printed > 0) {
+                std::fflush(stdout);
+            }
+            return printed;
+        }
+
+        [[nodiscard]] std::size_t pending() const {
+            return length;
+        }
+
+        [[nodiscard]] uint32_t droppedRecords() const {
+            return dropped;
+        }
+    };
+
+    class RingBufferLogger : public Logger {
+        LogRingBuffer* buffer;
+        std::string sep;
+
+        void push(double time, long modelId, const std::string& modelName, const std::string& portName, const std::string& data) {
+            char timeText[24];
+            char idText[24];
+            // %g prints doubles the same way as std::cout with its default precision
+            const int timeLength = std::snprintf(timeText, sizeof(timeText), "%g", time);
+            const int idLength = std::snprintf(idText, sizeof(idText), "%ld", modelId);
+            const std::pair<const char*, std::size_t> pieces[] = {
+                {timeText, static_cast<std::size_t>(timeLength)}, {sep.data(), sep.size()},
+                {idText, static_cast<std::size_t>(idLength)}, {sep.data(), sep.size()},
+                {modelName.data(), modelName.size()}, {sep.data(), sep.size()},
+                {portName.data(), portName.size()}, {sep.data(), sep.size()},
+                {data.data(), data.size()}, {"\n", 1}
+            };
+            buffer->push(pieces, sizeof(pieces) / sizeof(pieces[0]));
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param buffer ring buffer the log lines are queued in (shared with DrainingClock).
+         * @param sep separator placed between the fields of a line.
+         */
+        RingBufferLogger(LogRingBuffer* buffer, std::string sep): Logger(), buffer(buffer), sep(std::move(sep)) {}
+
+        void start() override {
+            const std::string header = "time" + sep + "model_id" + sep + "model_name" + sep + "port_name" + sep + "data\n";
+            const std::pair<const char*, std::size_t> pieces[] = {{header.data(), header.size()}};
+            buffer->push(pieces, 1);
+        }
+
+        /**
+         * Prints everything still queued, followed by the number of dropped records.
+         */
+        void stop() override {
+            buffer->drain(buffer->pending());
+            std::printf("%lu log records dropped in total\n", static_cast<unsigned long>(buffer->droppedRecords()));
+        }
+
+        void logOutput(double time, long modelId, const std::string& modelName, const std::string& portName, const std::string& output) override {
+            push(time, modelId, modelName, portName, output);
+        }
+
+        void logState(double time, long modelId, const std::string& modelName, const std::string& state) override {
+            push(time, modelId, modelName, "", state);
+        }
+    };
+} // namespace cadmium
+
+#endif // __RING_BUFFER_LOGGER_HPP__
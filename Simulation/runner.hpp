@@ -0,0 +1,240 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Main program shared by the examples, simulating their top model.
+ *
+ * The main.cpp of an example only gives its top model, its defaults and the
+ * low-power mode its board can sleep in:
+ *     return cadmium::run<elevatorSystem, cadmium::SleepMode::LPM0>({"elevatorSystem", "elevatorLog", 40.0}, argc, argv);
+ *
+ * On the desktop the top model is built with (name, input folder) and simulated from
+ * the command line, so one build can be scripted over many runs:
+ *     --horizon S      simulated seconds (default: the horizon of the example)
+ *     --log KIND       none, csv or binary (default: csv, binary with BINARY_LOGGING,
+ *                      none with NO_LOGGING, which also only accepts none)
+ *     --log-file PATH  log written (default: <log of the example>.csv or .bin)
+ *     --inputs FOLDER  folder holding the simulated input files (default: .)
+ *     --bench PATH     benchmarks the model instead, see benchmark.hpp, and writes the
+ *                      results to PATH
+ *     --realtime X     simulates in real time, X simulated seconds per wall second, on
+ *                      RealTimeRootCoordinator and ScaledClock (see scaledClock.hpp)
+ *     --skip-idle S    in real time, waits at most S simulated seconds between events
+ *     --jitter S       in real time, wakes up each event up to S simulated seconds late
+ *     --seed N         seed of the jitter (default: 0)
+ * The root coordinator is FlatRootCoordinator with FLAT_COUPLING, and the latency,
+ * transition and metrics reports are printed at the end with LATENCY_PROBES,
+ * PROFILE_TRANSITIONS and ONLINE_METRICS, after the lateness of the events in real time.
+ *
+ * With EMBED the command line is ignored: the top model is built from its name and
+ * simulated forever in real time, on TIClock with BUSY_WAIT and on LowPowerClock<Sleep>
+ * otherwise, logging over the UART between events unless NO_LOGGING is defined.
+ */
+
+#ifndef __RUNNER_HPP__
+#define __RUNNER_HPP__
+
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "sleepMode.hpp"
+
+#ifdef EMBED
+    #include <simulation/rt_root_coordinator.hpp>
+    #include "../IO_Models/lcdOutput.hpp"
+    #ifdef BUSY_WAIT
+        #include <simulation/rt_clock/ti_clock.hpp>
+    #else
+        // Sleeps in a low-power mode between events instead of busy-waiting on the timer
+        #include "lowPowerClock.hpp"
+        #include "lowPowerRootCoordinator.hpp"
+    #endif
+    #ifndef NO_LOGGING
+        #include "drainingClock.hpp"
+    #endif
+#else
+    #include <iostream>
+    #include <stdexcept>
+    #include <simulation/rt_root_coordinator.hpp>
+    #include "benchmark.hpp"
+    #include "commandLine.hpp"
+    #include "scaledClock.hpp"
+    #ifndef NO_LOGGING
+        #include <simulation/logger/csv.hpp>
+        #include "binaryLogger.hpp"
+    #endif
+    #ifdef LATENCY_PROBES
+        #include "latency.hpp"
+    #endif
+    #ifdef PROFILE_TRANSITIONS
+        #include "transitionProfiler.hpp"
+    #endif
+    #ifdef ONLINE_METRICS
+        #include "metrics.hpp"
+    #endif
+#endif
+
+namespace cadmium {
+
+    // What an example simulates when no option changes it
+    struct RunDefaults {
+        const char* name;    // ID of the top model
+        const char* log;     // Log file written on the desktop, without its extension
+        double horizon;      // Simulated seconds on the desktop
+    };
+
+#ifdef EMBED
+
+    template<typename TopModel, SleepMode Sleep>
+    int run(const RunDefaults& defaults, int, char*[]) {
+        // Declare and initialize the top model
+        auto model = std::make_shared<TopModel>(defaults.name);
+
+        BSP_LCD_Init(); // can comment this line out if not using the LCD screen - it will reduce embedded startup time
+    #ifdef BUSY_WAIT
+        using Clock = TIClock;
+    #else
+        using Clock = LowPowerClock<Sleep>;
+    #endif
+    #ifndef NO_LOGGING
+        // Log lines are queued in SRAM and printed while the clock waits for the next event
+        static char logStorage[4096];
+        static LogRingBuffer logBuffer(logStorage, sizeof(logStorage));
+        auto clock = DrainingClock<Clock>(&logBuffer);
+    #else
+        auto clock = Clock();
+    #endif
+    #ifdef BUSY_WAIT
+        auto rootCoordinator = RealTimeRootCoordinator(model, clock);
+    #else
+        auto rootCoordinator = LowPowerRootCoordinator(model, clock);
+    #endif
+    #ifndef NO_LOGGING
+        rootCoordinator.template setLogger<RingBufferLogger>(&logBuffer, ";");
+    #endif
+        // For embedded execution, we want to simulate the entire time we are in debug mode
+        rootCoordinator.start();
+        rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+        rootCoordinator.stop();
+        return 0;
+    }
+
+#else
+
+    enum class RunLog { None, Csv, Binary };
+
+    /**
+     * Simulates the top model on a root coordinator and prints the reports.
+     *
+     * @param rootCoordinator root coordinator of the top model.
+     * @param log kind of log written.
+     * @param logPath log file written.
+     * @param horizon simulated seconds.
+     */
+    template<typename Coordinator>
+    void simulateRun(Coordinator& rootCoordinator, RunLog log, const std::string& logPath, double horizon) {
+    #ifndef NO_LOGGING
+        if (log == RunLog::Binary) {
+            // Binary trace, converted to the same CSV with ../Tools/binaryLogToCsv
+            rootCoordinator.template setLogger<BinaryLogger>(logPath, ",");
+        } else if (log == RunLog::Csv) {
+            rootCoordinator.template setLogger<CSVLogger>(logPath, ",");
+        }
+    #endif
+        rootCoordinator.start();
+        rootCoordinator.simulate(horizon);
+        rootCoordinator.stop();
+    }
+
+    template<typename TopModel, SleepMode Sleep = SleepMode::LPM3>
+    int run(const RunDefaults& defaults, int argc, char* argv[]) {
+        double horizon = defaults.horizon;
+        std::string inputFolder = ".";
+    #if defined NO_LOGGING
+        RunLog log = RunLog::None;
+    #elif defined BINARY_LOGGING
+        RunLog log = RunLog::Binary;
+    #else
+        RunLog log = RunLog::Csv;
+    #endif
+        std::string logPath;
+        std::string benchPath;
+        double speed = 0;
+        double maxIdle = std::numeric_limits<double>::infinity();
+        double jitter = 0;
+        unsigned seed = 0;
+
+        const auto readLog = [&log](const std::string& value) {
+            if (value == "none") {
+                log = RunLog::None;
+            } else if (value == "csv") {
+                log = RunLog::Csv;
+            } else if (value == "binary") {
+                log = RunLog::Binary;
+            } else {
+                throw std::invalid_argument(value);
+            }
+        };
+        if (!parseCommandLine(argc, argv, {
+                {"--horizon", "S", numberOption(horizon)},
+                {"--log", "none|csv|binary", readLog},
+                {"--log-file", "PATH", textOption(logPath)},
+                {"--inputs", "FOLDER", textOption(inputFolder)},
+                {"--bench", "PATH", textOption(benchPath)},
+                {"--realtime", "X", numberOption(speed)},
+                {"--skip-idle", "S", numberOption(maxIdle)},
+                {"--jitter", "S", numberOption(jitter)},
+                {"--seed", "N", integerOption(seed)}})) {
+            return 1;
+        }
+
+    #ifdef NO_LOGGING
+        if (log != RunLog::None || !benchPath.empty()) {
+            std::cerr << "Built with NO_LOGGING: only --log none is available, and --bench is not" << std::endl;
+            return 1;
+        }
+    #else
+        if (!benchPath.empty()) {
+            return writeBenchmark<TopModel>(defaults.name, horizon, benchPath, inputFolder);
+        }
+    #endif
+
+        if (logPath.empty()) {
+            logPath = std::string(defaults.log) + (log == RunLog::Binary ? ".bin" : ".csv");
+        }
+        if (speed < 0 || (speed == 0 && (jitter > 0 || maxIdle < std::numeric_limits<double>::infinity()))) {
+            std::cerr << "--skip-idle and --jitter need --realtime with a positive speed" << std::endl;
+            return 1;
+        }
+
+        // Declare and initialize the top model
+        auto model = std::make_shared<TopModel>(defaults.name, inputFolder);
+        if (speed > 0) {
+            RealTimeStats stats;
+            auto rootCoordinator = RealTimeRootCoordinator(model, ScaledClock<>(&stats, speed, maxIdle, jitter, seed));
+        #ifdef LATENCY_PROBES
+            latencyModeledScale = 1 / speed; // The models wait in wall time, which the spans do not count
+        #endif
+            simulateRun(rootCoordinator, log, logPath, horizon);
+            stats.print();
+        } else {
+            auto rootCoordinator = DesktopRootCoordinator(model);
+            simulateRun(rootCoordinator, log, logPath, horizon);
+        }
+    #ifdef LATENCY_PROBES
+        printLatencyReport();
+    #endif
+    #ifdef PROFILE_TRANSITIONS
+        printTransitionProfile();
+    #endif
+    #ifdef ONLINE_METRICS
+        printMetricsReport(horizon);
+    #endif
+        return 0;
+    }
+
+#endif
+} // namespace cadmium
+
+#endif // __RUNNER_HPP__
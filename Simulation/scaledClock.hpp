@@ -0,0 +1,147 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * ScaledClock: real-time clock running the simulation faster than the wall time
+ * (desktop only).
+ *
+ * RealTimeRootCoordinator waits on the clock before every event, as it does on the
+ * MSP432, but a simulated day with ChronoClock takes a real day. ScaledClock waits
+ * for the same events with the simulated time scaled and the idle time shortened:
+ *  - speed: simulated seconds per wall second, e.g. 1 for ChronoClock, 1000 to
+ *    simulate a day in about 90 s
+ *  - maxIdle: longest gap between two events waited, in simulated seconds. A longer
+ *    gap (e.g. a night without floor requests) only waits maxIdle, while the events
+ *    of a burst keep their spacing and order
+ *  - jitter: each wait wakes up late by a random delay of up to jitter simulated
+ *    seconds, like an event served late on the board, the same for a given seed
+ * The models, their inputs and their log do not depend on the wall time, so a run
+ * logs exactly what RootCoordinator does. What it adds is the real-time code path,
+ * and the lateness of the events: an event is late when the transitions, the logging
+ * and the jitter of the events before it took longer than the time separating them.
+ * The lateness is given in simulated seconds, so a speed-up that keeps it small
+ * tells how much slack the models leave.
+ *
+ *     cadmium::RealTimeStats stats;
+ *     auto rootCoordinator = cadmium::RealTimeRootCoordinator(model, cadmium::ScaledClock<>(&stats, 1000, 60));
+ *     ...
+ *     stats.print();
+ */
+
+#ifndef __SCALED_CLOCK_HPP__
+#define __SCALED_CLOCK_HPP__
+
+#include <simulation/rt_clock/rt_clock.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+
+namespace cadmium {
+
+    // Lateness of the events waited by a ScaledClock
+    struct RealTimeStats {
+        uint64_t waits;     // Events waited for
+        uint64_t late;      // Events already due when the clock started waiting for them
+        double lateness;    // Sum of the lateness of the late events, in simulated seconds
+        double maxLateness; // Largest lateness, in simulated seconds
+        double skipped;     // Simulated seconds of idle time not waited
+        double wall;        // Wall seconds between the start and the stop of the clock
+
+        RealTimeStats(): waits(0), late(0), lateness(0), maxLateness(0), skipped(0), wall(0) {}
+
+        void print() const {
+            std::cout << "real time: " << waits << " events in " << wall << " s, "
+                      << late << " late (mean " << (late > 0 ? lateness / late : 0) << " s, max " << maxLateness << " s), "
+                      << skipped << " s of idle time skipped" << std::endl;
+        }
+    };
+
+    template<typename T = std::chrono::steady_clock>
+    class ScaledClock : public RealTimeClock {
+        RealTimeStats* stats;
+        double speed;
+        double maxIdle;
+        double jitter;
+        std::mt19937 random;
+        typename T::time_point startWall; // Wall time when the clock started
+        double startTime;                 // Simulation time waited at startWall, moved forward by the idle time skipped
+
+        // Wall time when the simulation time is reached
+        typename T::time_point wallOf(double time) const {
+            return startWall + std::chrono::duration_cast<typename T::duration>(std::chrono::duration<double>((time - startTime) / speed));
+        }
+
+     public:
+        /**
+         * Constructor function.
+         *
+         * @param stats lateness of the events, or nullptr if it is not measured.
+         * @param speed simulated seconds per wall second.
+         * @param maxIdle longest gap between two events waited, in simulated seconds.
+         * @param jitter largest random delay added to each wait, in simulated seconds.
+         * @param seed seed of the random delays.
+         */
+        explicit ScaledClock(RealTimeStats* stats = nullptr, double speed = 1,
+                             double maxIdle = std::numeric_limits<double>::infinity(), double jitter = 0, unsigned seed = 0):
+            RealTimeClock(), stats(stats), speed(speed > 0 ? speed : 1), maxIdle(maxIdle >= 0 ? maxIdle : 0),
+            jitter(jitter > 0 ? jitter : 0), random(seed), startWall(), startTime(0) {}
+
+        void start(double timeLast) override {
+            RealTimeClock::start(timeLast);
+            startWall = T::now();
+            startTime = timeLast;
+        }
+
+        void stop(double timeLast) override {
+            if (stats != nullptr) {
+                stats->wall += std::chrono::duration<double>(T::now() - startWall).count();
+            }
+            RealTimeClock::stop(timeLast);
+        }
+
+        /**
+         * Waits until the wall time of the next event, shortening the idle time and adding the jitter.
+         *
+         * @param timeNext simulation time of the next event.
+         * @return timeNext, as no event interrupts the wait on the desktop.
+         */
+        double waitUntil(double timeNext) override {
+            if (std::isinf(timeNext)) {
+                return timeNext;
+            }
+            const double gap = timeNext - vTimeLast;
+            if (gap > maxIdle) {
+                startTime += gap - maxIdle;
+                if (stats != nullptr) {
+                    stats->skipped += gap - maxIdle;
+                }
+            }
+            double delay = 0;
+            if (jitter > 0) {
+                delay = std::uniform_real_distribution<double>(0, jitter)(random);
+            }
+            const auto due = wallOf(timeNext + delay);
+            const auto now = T::now();
+            if (now < due) {
+                std::this_thread::sleep_until(due);
+            }
+            if (stats != nullptr) {
+                stats->waits++;
+                const double lateness = std::chrono::duration<double>(now - wallOf(timeNext)).count() * speed;
+                if (lateness > 0) {
+                    stats->late++;
+                    stats->lateness += lateness;
+                    stats->maxLateness = lateness > stats->maxLateness ? lateness : stats->maxLateness;
+                }
+            }
+            vTimeLast = timeNext;
+            return timeNext;
+        }
+    };
+} // namespace cadmium
+
+#endif // __SCALED_CLOCK_HPP__
@@ -0,0 +1,20 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Low-power modes the MSP432 sleeps in between events, see lowPowerClock.hpp.
+ *
+ * Kept apart from LowPowerClock so that runner.hpp can take the mode of an example
+ * as a template parameter in every build, including the desktop ones.
+ */
+
+#ifndef __SLEEP_MODE_HPP__
+#define __SLEEP_MODE_HPP__
+
+namespace cadmium {
+
+    enum class SleepMode { LPM0, LPM3 };
+
+} // namespace cadmium
+
+#endif // __SLEEP_MODE_HPP__
@@ -0,0 +1,201 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Parameter sweep driver for the desktop builds. runSweep() simulates many
+ * independent variants of a top model on a pool of worker threads, each run with
+ * its own RootCoordinator, and keeps a summary of every run in memory instead of
+ * writing one CSV file per run.
+ *
+ * Workers take the next run from a shared counter as soon as they are done with
+ * the previous one, so long and short runs balance out over the pool.
+ *
+ * The summary of a run is gathered by a CountingLogger: wall time, transitions of
+ * every atomic model and messages sent on every output port. The program has to
+ * be compiled without NO_LOGGING for the counts to be collected.
+ */
+
+#ifndef __SWEEP_HPP__
+#define __SWEEP_HPP__
+
+#include <simulation/root_coordinator.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "commandLine.hpp"
+#include "countingLogger.hpp"
+
+namespace cadmium {
+
+    struct SweepRun {
+        std::size_t index = 0;
+        double wallTime = 0;
+        SimulationCounts counts;
+        std::string error; // Empty unless the run threw an exception
+
+        [[nodiscard]] uint64_t transitions() const {
+            uint64_t total = 0;
+            for (const auto& [id, model] : counts.models) {
+                total += model.transitions();
+            }
+            return total;
+        }
+
+        [[nodiscard]] uint64_t messages() const {
+            uint64_t total = 0;
+            for (const auto& [id, model] : counts.models) {
+                for (const auto& [port, messages] : model.messages) {
+                    total += messages;
+                }
+            }
+            return total;
+        }
+    };
+
+    /**
+     * Runs independent simulations on a pool of threads.
+     *
+     * @param runs number of simulations.
+     * @param makeModel function creating the top model of run i (called from the worker threads).
+     * @param horizon simulated time of every run, in seconds.
+     * @param threads number of worker threads, 0 to use one per hardware thread.
+     * @return the summary of every run, in run order.
+     */
+    template<typename MakeModel>
+    std::vector<SweepRun> runSweep(std::size_t runs, MakeModel makeModel, double horizon, unsigned threads = 0) {
+        if (threads == 0) {
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        threads = static_cast<unsigned>(std::min<std::size_t>(threads, std::max<std::size_t>(runs, 1)));
+
+        std::vector<SweepRun> results(runs);
+        std::atomic<std::size_t> next{0};
+        const auto worker = [&]() {
+            for (std::size_t i = next++; i < runs; i = next++) {
+                SweepRun& run = results[i];
+                run.index = i;
+                const auto start = std::chrono::steady_clock::now();
+                try {
+                    auto rootCoordinator = RootCoordinator(makeModel(i));
+                    rootCoordinator.template setLogger<CountingLogger>(&run.counts);
+                    rootCoordinator.start();
+                    rootCoordinator.simulate(horizon);
+                    rootCoordinator.stop();
+                } catch (const std::exception& e) {
+                    run.error = e.what();
+                }
+                run.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; t++) {
+            pool.emplace_back(worker);
+        }
+        worker(); // The calling thread works too
+        for (auto& thread : pool) {
+            thread.join();
+        }
+        return results;
+    }
+
+    // Quoted CSV field, with its quotes doubled (RFC 4180)
+    inline std::string csvString(const std::string& str) {
+        std::string quoted = "\"";
+        for (const char c : str) {
+            if (c == '"') {
+                quoted += '"';
+            }
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    /**
+     * Writes one CSV row per run: its parameters, its totals and the number of
+     * messages sent on every port seen in any of the runs ("model.port" columns).
+     *
+     * @param out stream the table is written to.
+     * @param parameterHeader CSV header of the parameter columns (e.g. "greenredLightTime,yellowLightTime").
+     * @param parameters CSV values of the parameter columns of every run.
+     * @param results summaries returned by runSweep.
+     */
+    inline void writeSweepCsv(std::ostream& out, const std::string& parameterHeader,
+                              const std::vector<std::string>& parameters, const std::vector<SweepRun>& results) {
+        std::set<std::string> ports;
+        for (const auto& run : results) {
+            for (const auto& [id, model] : run.counts.models) {
+                for (const auto& [port, messages] : model.messages) {
+                    ports.insert(model.name + "." + port);
+                }
+            }
+        }
+
+        out << "run," << parameterHeader << ",wall_time_s,transitions,messages";
+        for (const auto& port : ports) {
+            out << "," << port;
+        }
+        out << ",error\n";
+        for (const auto& run : results) {
+            out << run.index << "," << parameters[run.index] << "," << run.wallTime << ","
+                << run.transitions() << "," << run.messages();
+            std::map<std::string, uint64_t> runPorts;
+            for (const auto& [id, model] : run.counts.models) {
+                for (const auto& [port, messages] : model.messages) {
+                    runPorts[model.name + "." + port] += messages;
+                }
+            }
+            for (const auto& port : ports) {
+                const auto it = runPorts.find(port);
+                out << "," << (it != runPorts.end() ? it->second : 0);
+            }
+            out << "," << csvString(run.error) << "\n";
+        }
+    }
+
+    /**
+     * Splits a comma separated command line argument (e.g. "4,6,8").
+     *
+     * @param list text of the argument.
+     * @return the items of the list.
+     */
+    inline std::vector<std::string> splitList(const std::string& list) {
+        std::vector<std::string> items;
+        std::stringstream stream(list);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (!item.empty()) {
+                items.push_back(item);
+            }
+        }
+        return items;
+    }
+
+    inline std::string numberText(double number) {
+        std::ostringstream text;
+        text << number;
+        return text.str();
+    }
+
+    inline std::vector<double> parseNumberList(const std::string& list) {
+        std::vector<double> numbers;
+        for (const auto& item : splitList(list)) {
+            numbers.push_back(parseNumber(item));
+        }
+        return numbers;
+    }
+} // namespace cadmium
+
+#endif // __SWEEP_HPP__
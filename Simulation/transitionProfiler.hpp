@@ -0,0 +1,219 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Per-model profile of the DEVS functions, compiled only with PROFILE_TRANSITIONS.
+ *
+ * The systems add their controller models as Profiled<Model>:
+ *
+ *     auto elevatorNum = addComponent<Profiled<ElevatorNum>>("elevatorNum");
+ *
+ * Without PROFILE_TRANSITIONS, Profiled<Model> is Model itself and nothing changes.
+ * With it, Profiled<Model> is a ProfiledModel<Model>, which derives from the model
+ * and times each call of internalTransition, externalTransition, output and
+ * timeAdvance (confluent transitions are timed as the internal and external
+ * transitions they call). The timestamps are those of Simulation/cycleCounter.hpp,
+ * so it works on the MSP432 as well as on the desktop. Every model keeps, for each
+ * function, the number of calls and the total and longest time in its own
+ * TransitionProfile, updated without allocating.
+ *
+ * printTransitionProfile() prints every function of every model still alive,
+ * sorted by total time, with printf (over the UART on the MSP432, see ProbeReporter).
+ * The time of the clock reads themselves, a few tens of nanoseconds on the desktop
+ * and a few cycles on the MSP432, is included in the figures.
+ */
+
+#ifndef __TRANSITION_PROFILER_HPP__
+#define __TRANSITION_PROFILER_HPP__
+
+#ifdef PROFILE_TRANSITIONS
+
+#include <modeling/devs/atomic.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cycleCounter.hpp"
+
+namespace cadmium {
+
+    enum class ProfiledFunction : uint8_t {
+        InternalTransition,
+        ExternalTransition,
+        Output,
+        TimeAdvance
+    };
+
+    inline const char* profiledFunctionName(ProfiledFunction function) {
+        switch (function) {
+            case ProfiledFunction::InternalTransition: return "internalTransition";
+            case ProfiledFunction::ExternalTransition: return "externalTransition";
+            case ProfiledFunction::Output: return "output";
+            default: return "timeAdvance";
+        }
+    }
+
+    struct FunctionProfile {
+        uint32_t calls;
+        uint64_t totalTicks;
+        uint32_t maxTicks;
+    };
+
+    class TransitionProfile {
+        static inline TransitionProfile* first = nullptr; // Every model alive, for printTransitionProfile()
+
+        TransitionProfile* previous;
+        TransitionProfile* next;
+
+     public:
+        static constexpr std::size_t FUNCTIONS = 4;
+
+        const Component& model;
+        FunctionProfile functions[FUNCTIONS];
+
+        explicit TransitionProfile(const Component& model): previous(nullptr), next(first), model(model), functions() {
+            if (first != nullptr) {
+                first->previous = this;
+            }
+            first = this;
+            startCycleCounter();
+        }
+
+        TransitionProfile(const TransitionProfile&) = delete;
+        TransitionProfile& operator=(const TransitionProfile&) = delete;
+
+        ~TransitionProfile() {
+            (previous != nullptr ? previous->next : first) = next;
+            if (next != nullptr) {
+                next->previous = previous;
+            }
+        }
+
+        static const TransitionProfile* all() {
+            return first;
+        }
+
+        [[nodiscard]] const TransitionProfile* following() const {
+            return next;
+        }
+
+        /**
+         * Adds a call of a function.
+         *
+         * @param function function called.
+         * @param ticks duration of the call, in ticks of cycleNow().
+         */
+        void add(ProfiledFunction function, CycleTicks ticks) {
+            FunctionProfile& profile = functions[static_cast<std::size_t>(function)];
+            const uint64_t elapsed = ticks;
+            const auto duration = static_cast<uint32_t>(elapsed > UINT32_MAX ? UINT32_MAX : elapsed);
+            profile.calls++;
+            profile.totalTicks += duration;
+            profile.maxTicks = duration > profile.maxTicks ? duration : profile.maxTicks;
+        }
+    };
+
+    // Gives the state type S of a model deriving from Atomic<S>
+    template<typename S>
+    S atomicStateOf(const Atomic<S>*);
+
+    template<typename Model>
+    class ProfiledModel : public Model {
+        using State = decltype(atomicStateOf(static_cast<const Model*>(nullptr)));
+
+        mutable TransitionProfile profile;
+
+        /**
+         * Calls a function of the model and adds its duration to the profile.
+         *
+         * @param function function called.
+         * @param call calls the function of the model.
+         * @return the value returned by the function.
+         */
+        template<typename Call>
+        auto timed(ProfiledFunction function, Call&& call) const {
+            const CycleTicks start = cycleNow();
+            if constexpr (std::is_void_v<decltype(call())>) {
+                call();
+                profile.add(function, cycleNow() - start);
+            } else {
+                const auto result = call();
+                profile.add(function, cycleNow() - start);
+                return result;
+            }
+        }
+
+     public:
+        template<typename... Args>
+        explicit ProfiledModel(Args&&... args): Model(std::forward<Args>(args)...), profile(*this) {}
+
+        void internalTransition(State& state) const override {
+            timed(ProfiledFunction::InternalTransition, [&]() { Model::internalTransition(state); });
+        }
+
+        void externalTransition(State& state, double e) const override {
+            timed(ProfiledFunction::ExternalTransition, [&]() { Model::externalTransition(state, e); });
+        }
+
+        void output(const State& state) const override {
+            timed(ProfiledFunction::Output, [&]() { Model::output(state); });
+        }
+
+        [[nodiscard]] double timeAdvance(const State& state) const override {
+            return timed(ProfiledFunction::TimeAdvance, [&]() { return Model::timeAdvance(state); });
+        }
+    };
+
+    template<typename Model>
+    using Profiled = ProfiledModel<Model>;
+
+    /**
+     * Prints the profile of every function called so far, the most expensive first.
+     * Call it once the simulation stopped, or from a model (see ProbeReporter).
+     */
+    inline void printTransitionProfile() {
+        struct Row {
+            const TransitionProfile* model;
+            ProfiledFunction function;
+        };
+        std::vector<Row> rows;
+        for (const TransitionProfile* model = TransitionProfile::all(); model != nullptr; model = model->following()) {
+            for (std::size_t i = 0; i < TransitionProfile::FUNCTIONS; i++) {
+                if (model->functions[i].calls != 0) {
+                    rows.push_back({model, static_cast<ProfiledFunction>(i)});
+                }
+            }
+        }
+        const auto profileOf = [](const Row& row) -> const FunctionProfile& {
+            return row.model->functions[static_cast<std::size_t>(row.function)];
+        };
+        std::sort(rows.begin(), rows.end(), [&profileOf](const Row& a, const Row& b) {
+            return profileOf(a).totalTicks > profileOf(b).totalTicks;
+        });
+
+        std::printf("%-24s %-20s %10s %12s %10s %10s\n", "model", "function", "calls", "total us", "mean ns", "max ns");
+        for (const Row& row : rows) {
+            const FunctionProfile& profile = profileOf(row);
+            std::printf("%-24s %-20s %10lu %12lu %10lu %10lu\n", row.model->model.getId().c_str(),
+                        profiledFunctionName(row.function), static_cast<unsigned long>(profile.calls),
+                        static_cast<unsigned long>(cycleMicroseconds(profile.totalTicks)),
+                        static_cast<unsigned long>(cycleNanoseconds(profile.totalTicks) / profile.calls),
+                        static_cast<unsigned long>(cycleNanoseconds(profile.maxTicks)));
+        }
+    }
+} // namespace cadmium
+
+#else
+
+namespace cadmium {
+    template<typename Model>
+    using Profiled = Model;
+} // namespace cadmium
+
+#endif // PROFILE_TRANSITIONS
+
+#endif // __TRANSITION_PROFILER_HPP__
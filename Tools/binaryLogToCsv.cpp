@@ -0,0 +1,125 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Converts a binary trace written by BinaryLogger into the CSV file CSVLogger
+ * would have written for the same simulation, byte for byte.
+ *
+ * Usage: binaryLogToCsv <trace.bin> <output.csv>
+ *
+ * Build: g++ -O2 -std=c++17 binaryLogToCsv.cpp -o binaryLogToCsv
+ * (or "make binlog2csv" from any of the example folders)
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Simulation/binaryLogFormat.hpp"
+
+using namespace cadmium;
+
+namespace {
+
+    template<typename T>
+    bool read(std::istream& in, T& value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    bool read(std::istream& in, std::string& str) {
+        uint32_t length;
+        if (!read(in, length)) {
+            return false;
+        }
+        str.resize(length);
+        return length == 0 || static_cast<bool>(in.read(&str[0], length));
+    }
+
+    int fail(const std::string& message) {
+        std::cerr << "binaryLogToCsv: " << message << std::endl;
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <trace.bin> <output.csv>" << std::endl;
+        return 1;
+    }
+
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in) {
+        return fail(std::string("cannot open ") + argv[1]);
+    }
+
+    char magic[sizeof(binlog::MAGIC)];
+    uint32_t version;
+    std::string sep;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, binlog::MAGIC, sizeof(magic)) != 0) {
+        return fail(std::string(argv[1]) + " is not a binary trace");
+    }
+    if (!read(in, version) || version != binlog::VERSION) {
+        return fail("unsupported trace version");
+    }
+    if (!read(in, sep)) {
+        return fail("truncated header");
+    }
+
+    std::ofstream out(argv[2]);
+    if (!out) {
+        return fail(std::string("cannot create ") + argv[2]);
+    }
+    // Same header and row formatting as CSVLogger
+    out << "time" << sep << "model_id" << sep << "model_name" << sep << "port_name" << sep << "data" << std::endl;
+
+    std::unordered_map<int64_t, std::string> modelNames;
+    std::vector<std::string> portNames;
+    std::string name, data;
+    binlog::RecordType type;
+    while (read(in, type)) {
+        double time;
+        int64_t modelId;
+        uint32_t portId;
+        switch (type) {
+            case binlog::RecordType::ModelName:
+                if (!read(in, modelId) || !read(in, name)) {
+                    return fail("truncated model name record");
+                }
+                modelNames[modelId] = name;
+                break;
+            case binlog::RecordType::PortName:
+                if (!read(in, portId) || !read(in, name)) {
+                    return fail("truncated port name record");
+                }
+                if (portId >= portNames.size()) {
+                    portNames.resize(portId + 1);
+                }
+                portNames[portId] = name;
+                break;
+            case binlog::RecordType::Output:
+                if (!read(in, time) || !read(in, modelId) || !read(in, portId) || !read(in, data)) {
+                    return fail("truncated output record");
+                }
+                if (portId >= portNames.size()) {
+                    return fail("output record refers to an unknown port");
+                }
+                out << time << sep << static_cast<long>(modelId) << sep << modelNames[modelId] << sep
+                    << portNames[portId] << sep << data << "\n";
+                break;
+            case binlog::RecordType::State:
+                if (!read(in, time) || !read(in, modelId) || !read(in, data)) {
+                    return fail("truncated state record");
+                }
+                out << time << sep << static_cast<long>(modelId) << sep << modelNames[modelId] << sep
+                    << sep << data << "\n";
+                break;
+            default:
+                return fail("unknown record type " + std::to_string(static_cast<int>(type)));
+        }
+    }
+    return 0;
+}
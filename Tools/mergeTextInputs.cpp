@@ -0,0 +1,80 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Merges IEStream text input files ("time value" on every line) into a single
+ * trace for TraceInput ("time channel value" on every line), sorted by time.
+ * Lines with the same time keep the order of the files on the command line.
+ *
+ * Usage: mergeTextInputs <trace.txt> <channel>=<input.txt> [<channel>=<input.txt> ...]
+ * e.g.   mergeTextInputs inputTrace.txt button=buttonInput.txt x=joyStickXInput.txt y=joyStickYInput.txt
+ *
+ * Build: g++ -O2 -std=c++17 mergeTextInputs.cpp -o mergeTextInputs
+ * (or "make merged-input" from the elevator and garage examples)
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Line {
+        double time;
+        std::string timeText; // Written back as it was read, so no precision is lost
+        std::string channel;
+        std::string value;
+    };
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <trace.txt> <channel>=<input.txt> [<channel>=<input.txt> ...]" << std::endl;
+        return 1;
+    }
+
+    std::vector<Line> lines;
+    for (int arg = 2; arg < argc; arg++) {
+        const std::string spec = argv[arg];
+        const std::size_t equals = spec.find('=');
+        if (equals == std::string::npos || equals == 0) {
+            std::cerr << "mergeTextInputs: expected <channel>=<input.txt>, got " << spec << std::endl;
+            return 1;
+        }
+        const std::string channel = spec.substr(0, equals);
+        const std::string path = spec.substr(equals + 1);
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "mergeTextInputs: cannot open " << path << std::endl;
+            return 1;
+        }
+        Line line;
+        line.channel = channel;
+        while (in >> line.timeText >> line.value) {
+            try {
+                line.time = std::stod(line.timeText);
+            } catch (const std::exception&) {
+                std::cerr << "mergeTextInputs: " << path << ": bad time " << line.timeText << std::endl;
+                return 1;
+            }
+            if (line.value == "true" || line.value == "false") {
+                line.value = line.value == "true" ? "1" : "0";
+            }
+            lines.push_back(line);
+        }
+    }
+
+    std::stable_sort(lines.begin(), lines.end(), [](const Line& a, const Line& b) { return a.time < b.time; });
+
+    std::ofstream out(argv[1]);
+    if (!out) {
+        std::cerr << "mergeTextInputs: cannot create " << argv[1] << std::endl;
+        return 1;
+    }
+    for (const Line& line : lines) {
+        out << line.timeText << " " << line.channel << " " << line.value << "\n";
+    }
+    return 0;
+}
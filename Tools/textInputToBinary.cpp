@@ -0,0 +1,90 @@
+/**
+ * ARSLab - Carleton University
+ * October 14th, 2026
+ *
+ * Converts an IEStream text input file ("time value" on every line) into the
+ * binary format read by BinaryInputStream.
+ *
+ * Usage: textInputToBinary <bool|int|double> <input.txt> <output.bin>
+ *
+ * The type must match the template argument of the BinaryInputStream reading the
+ * file. Times must not decrease from one line to the next.
+ *
+ * Build: g++ -O2 -std=c++17 textInputToBinary.cpp -o textInputToBinary
+ * (or "make binary-input" from the elevator and garage examples)
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Shared_Models/binaryInputFormat.hpp"
+
+using namespace cadmium::shared;
+
+namespace {
+
+    template<typename T>
+    int convert(const char* inputPath, const char* outputPath) {
+        std::ifstream in(inputPath);
+        if (!in) {
+            std::cerr << "textInputToBinary: cannot open " << inputPath << std::endl;
+            return 1;
+        }
+
+        std::vector<BinaryInputRecord<T>> records;
+        BinaryInputRecord<T> record;
+        std::memset(&record, 0, sizeof(record)); // Padding bytes are written to the file too
+        while (in >> record.time >> record.value) {
+            if (!records.empty() && record.time < records.back().time) {
+                std::cerr << "textInputToBinary: " << inputPath << " line " << records.size() + 1
+                          << " goes back in time" << std::endl;
+                return 1;
+            }
+            records.push_back(record);
+        }
+        if (!in.eof()) {
+            std::cerr << "textInputToBinary: cannot parse " << inputPath << " line " << records.size() + 1 << std::endl;
+            return 1;
+        }
+
+        BinaryInputHeader header{};
+        std::memcpy(header.magic, BINARY_INPUT_MAGIC, sizeof(header.magic));
+        header.version = BINARY_INPUT_VERSION;
+        header.valueSize = sizeof(T);
+        header.recordSize = sizeof(BinaryInputRecord<T>);
+        header.count = records.size();
+
+        std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(records.data()),
+                  static_cast<std::streamsize>(records.size() * sizeof(BinaryInputRecord<T>)));
+        if (!out) {
+            std::cerr << "textInputToBinary: cannot write " << outputPath << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <bool|int|double> <input.txt> <output.bin>" << std::endl;
+        return 1;
+    }
+    const std::string type = argv[1];
+    if (type == "bool") {
+        return convert<bool>(argv[2], argv[3]);
+    }
+    if (type == "int") {
+        return convert<int>(argv[2], argv[3]);
+    }
+    if (type == "double") {
+        return convert<double>(argv[2], argv[3]);
+    }
+    std::cerr << "textInputToBinary: unknown type " << type << std::endl;
+    return 1;
+}